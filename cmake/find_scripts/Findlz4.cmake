@@ -0,0 +1,28 @@
+find_path(lz4_INCLUDE_DIR
+  NAMES lz4.h
+  PATHS
+  include
+  ${CMAKE_SOURCE_DIR}/thirdparty/lz4/lib
+)
+
+find_library(lz4_LIBRARY
+  NAMES lz4 liblz4
+)
+
+include(FindPackageHandleStandardArgs)
+find_package_handle_standard_args(lz4
+  REQUIRED_VARS lz4_LIBRARY lz4_INCLUDE_DIR
+)
+
+if(lz4_FOUND)
+  if(NOT TARGET lz4::lz4)
+    set(lz4_INCLUDE_DIRS ${lz4_INCLUDE_DIR})
+    set(lz4_LIBRARIES ${lz4_LIBRARY})
+
+    add_library(lz4::lz4 UNKNOWN IMPORTED)
+    set_target_properties(lz4::lz4 PROPERTIES
+      IMPORTED_LOCATION ${lz4_LIBRARY}
+      INTERFACE_INCLUDE_DIRECTORIES ${lz4_INCLUDE_DIR})
+    mark_as_advanced(lz4_INCLUDE_DIR lz4_LIBRARY)
+  endif()
+endif()
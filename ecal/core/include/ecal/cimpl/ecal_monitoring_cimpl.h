@@ -82,6 +82,18 @@ extern "C"
   **/
   ECALC_API int eCAL_Monitoring_GetMonitoring(void* buf_, int buf_len_);
 
+  /**
+   * @brief Get monitoring delta protobuf string (see eCAL::Monitoring::GetMonitoringDelta).
+   *
+   * @param       since_version_  Version of the last received delta (zero for a full snapshot).
+   * @param [out] buf_            Pointer to store the monitoring delta information.
+   * @param       buf_len_        Length of allocated buffer or ECAL_ALLOCATE_4ME if
+   *                              eCAL should allocate the buffer for you (see eCAL_FreeMem).
+   *
+   * @return  Monitoring buffer length or zero if failed.
+  **/
+  ECALC_API int eCAL_Monitoring_GetMonitoringDelta(long long since_version_, void* buf_, int buf_len_);
+
   /**
    * @brief Get logging string.
    *
@@ -146,6 +146,37 @@ extern "C"
   **/
   ECALC_API int eCAL_Pub_SetMaxBandwidthUDP(ECAL_HANDLE handle_, long bandwidth_);
 
+  /**
+   * @brief Enable batching of small messages (default off).
+   *
+   * @param handle_        Publisher handle.
+   * @param max_messages_  Maximum number of messages per frame (< 2 switches batching off).
+   * @param max_bytes_     Maximum frame size in bytes (0 == unlimited).
+   * @param max_delay_ms_  Maximum time a message waits in a frame in ms (0 == until flushed).
+   *
+   * @return  True if it succeeds, false if it fails.
+  **/
+  ECALC_API int eCAL_Pub_SetBatching(ECAL_HANDLE handle_, int max_messages_, int max_bytes_, int max_delay_ms_);
+
+  /**
+   * @brief Set payload compression for the udp layers (default none).
+   *
+   * @param handle_       Publisher handle.
+   * @param compression_  Compression codec.
+   *
+   * @return  True if it succeeds, false if the codec is not available.
+  **/
+  ECALC_API int eCAL_Pub_SetCompressionUDP(ECAL_HANDLE handle_, enum eCompressionC compression_);
+
+  /**
+   * @brief Send the pending batch frame immediately.
+   *
+   * @param handle_  Publisher handle.
+   *
+   * @return  Number of bytes sent.
+  **/
+  ECALC_API int eCAL_Pub_Flush(ECAL_HANDLE handle_);
+
   /**
    * @brief Set publisher maximum transmit bandwidth for the udp layer.
    *
@@ -52,4 +52,13 @@ enum eSendModeC
   smode_auto
 };
 
+/**
+ * @brief eCAL network layer payload compression.
+**/
+enum eCompressionC
+{
+  compression_none = 0,
+  compression_lz4  = 1
+};
+
 #endif /*ecal_tlayer_cimpl_h_included*/
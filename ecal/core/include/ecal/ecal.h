@@ -39,6 +39,7 @@
 #include <ecal/ecal_server.h>
 #include <ecal/ecal_service_info.h>
 #include <ecal/ecal_subscriber.h>
+#include <ecal/ecal_thread_attr.h>
 #include <ecal/ecal_time.h>
 #include <ecal/ecal_timer.h>
 #include <ecal/ecal_tlayer.h>
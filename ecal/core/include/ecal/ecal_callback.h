@@ -63,6 +63,7 @@ enum eCAL_Registration_Event
 
 #ifdef __cplusplus
 
+#include <cstddef>
 #include <functional>
 
 namespace eCAL
@@ -88,6 +89,7 @@ namespace eCAL
   };
 
   typedef std::function<void(const char* topic_name_, const struct SReceiveCallbackData* data_)> ReceiveCallbackT;
+  typedef std::function<bool(const void* buf_, size_t size_)> ReceiveBufferT;
   typedef std::function<void(void)> TimerCallbackT;
   typedef std::function<void(const char* sample_, int sample_size_)> RegistrationCallbackT;
 
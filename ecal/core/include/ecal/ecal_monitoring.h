@@ -67,6 +67,26 @@ namespace eCAL
     **/
     ECAL_API int GetMonitoring(std::string& mon_);
 
+    /**
+     * @brief Get monitoring delta protobuf string (eCAL::pb::MonitoringDelta).
+     *
+     * Returns all processes, services and topics that were added or changed
+     * after the given version and all that were removed since then. Pass the
+     * version of the last received delta to get the next one. If the version
+     * is zero or too old, the delta is flagged as 'full' and contains the
+     * complete monitoring state. Identity, configuration and state changes
+     * are reported immediately, changed live statistics (data clock,
+     * frequencies, drops, cpu and memory usage, call counts) at most once
+     * per [monitoring] stats_interval. Removals carry their version and
+     * removal time.
+     *
+     * @param       since_version_  Version of the last received delta (zero for a full snapshot).
+     * @param [out] mon_            String to store the monitoring delta information.
+     *
+     * @return  Monitoring buffer length or zero if failed.
+    **/
+    ECAL_API int GetMonitoringDelta(long long since_version_, std::string& mon_);
+
     /**
      * @brief Get logging protobuf string. 
      *
@@ -136,6 +156,18 @@ namespace eCAL
       return(static_cast<int>(mon_.size()));
     }
 
+    inline int GetMonitoringDelta(long long since_version_, std::string& mon_)
+    {
+      void* buf = nullptr;
+      size_t buf_len = eCAL_Monitoring_GetMonitoringDelta(since_version_, &buf, ECAL_ALLOCATE_4ME);
+      if(buf_len > 0)
+      {
+        mon_ = std::string(static_cast<char*>(buf), buf_len);
+        eCAL_FreeMem(buf);
+      }
+      return(static_cast<int>(mon_.size()));
+    }
+
     inline int GetLogging(std::string& mon_)
     {
       void* buf = nullptr;
@@ -173,7 +173,7 @@ namespace eCAL
      * @param layer_  Transport layer.
      * @param mode_   Send mode.
      *
-     * @return  True if it succeeds, false if it fails. 
+     * @return  True if it succeeds, false if it fails (e.g. the layer is not available in this build). 
     **/
     bool SetLayerMode(TLayer::eTransportLayer layer_, TLayer::eSendMode mode_);
 
@@ -196,6 +196,41 @@ namespace eCAL
     **/
     bool SetMaxBandwidthUDP(long bandwidth_);
 
+    /**
+     * @brief Enable batching of small messages (default off).
+     *
+     *        Sent messages are packed into one transport frame until one of the limits is reached,
+     *        subscribers unpack them transparently (every message keeps its own id, clock and time).
+     *        Send returns the message length as soon as the message is queued.
+     *
+     * @param max_messages_  Maximum number of messages per frame (< 2 switches batching off).
+     * @param max_bytes_     Maximum frame size in bytes (0 == unlimited).
+     * @param max_delay_ms_  Maximum time a message waits in a frame in ms (0 == until Flush).
+     *
+     * @return  True if it succeeds, false if it fails.
+    **/
+    bool SetBatching(size_t max_messages_, size_t max_bytes_, int max_delay_ms_);
+
+    /**
+     * @brief Set payload compression for the udp layers (default none).
+     *
+     *        The payload is compressed once per send call and only if every connected subscriber
+     *        announced the codec (subscribers of older versions keep receiving plain samples).
+     *        Small samples and samples that do not shrink are sent uncompressed.
+     *
+     * @param compression_  Compression codec.
+     *
+     * @return  True if it succeeds, false if the codec is not available in this build.
+    **/
+    bool SetCompressionUDP(TLayer::eCompression compression_);
+
+    /**
+     * @brief Send the pending batch frame immediately.
+     *
+     * @return  Number of bytes sent.
+    **/
+    size_t Flush() const;
+
     /**
      * @brief Set the the specific topic id.
      *
@@ -208,11 +243,19 @@ namespace eCAL
     /**
      * @brief Send a message to all subscribers. 
      *
+     *        Send may be called from several threads concurrently, every call gets its own
+     *        message clock. The transport layers serialize the writes per layer, so samples of
+     *        different threads can arrive out of clock order (subscribers may report them as drops).
+     *
+     *        With batching enabled (see SetBatching) the message is only queued into the pending
+     *        batch frame, the returned length is the queued message length then and the frame is
+     *        sent when one of the batch limits is reached or on Flush.
+     *
      * @param buf_    Pointer to content buffer. 
      * @param len_    Length of buffer. 
      * @param time_   Send time (-1 = use eCAL system time in us, default = -1).
      *
-     * @return  Number of bytes sent. 
+     * @return  Number of bytes sent (or queued for batching). 
     **/
     size_t Send(const void* const buf_, size_t len_, long long time_ = -1) const;
 
@@ -513,6 +556,24 @@ namespace eCAL
       return(eCAL_Pub_SetMaxBandwidthUDP(m_publisher, bandwidth_) != 0);
     }
 
+    bool SetBatching(size_t max_messages_, size_t max_bytes_, int max_delay_ms_)
+    {
+      if (!m_publisher) return(false);
+      return(eCAL_Pub_SetBatching(m_publisher, static_cast<int>(max_messages_), static_cast<int>(max_bytes_), max_delay_ms_) != 0);
+    }
+
+    bool SetCompressionUDP(TLayer::eCompression compression_)
+    {
+      if (!m_publisher) return(false);
+      return(eCAL_Pub_SetCompressionUDP(m_publisher, static_cast<eCompressionC>(compression_)) != 0);
+    }
+
+    size_t Flush() const
+    {
+      if (!m_publisher) return(0);
+      return(static_cast<size_t>(eCAL_Pub_Flush(m_publisher)));
+    }
+
     bool SetID(long long id_)
     {
       if (!m_publisher) return(false);
@@ -72,10 +72,14 @@ namespace eCAL
         history_kind       = keep_last_history_qos;
         history_kind_depth = 8;
         reliability        = best_effort_reliability_qos;
+        shm_spin_time      = 0;
+        shm_spin_cpu       = -1;
       }
       eQOSPolicy_HistoryKind  history_kind;              //!< qos history kind mode
       int                     history_kind_depth;        //!< qos history kind mode depth
       eQOSPolicy_Reliability  reliability;               //!< qos reliability mode
+      int                     shm_spin_time;             //!< shared memory busy poll time in us before blocking (0 = blocking only, the subscribers of a topic in one process share the longest)
+      int                     shm_spin_cpu;              //!< cpu the shared memory receive thread is pinned to (-1 = not pinned, taken from the subscriber with the longest spin time)
     };
   }
 }
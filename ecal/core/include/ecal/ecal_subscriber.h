@@ -168,6 +168,11 @@ namespace eCAL
     /**
      * @brief Receive a message from the publisher. 
      *
+     *        Without a receive callback incoming messages are queued in order. The queue depth
+     *        is set by the [subscriber] receive_queue_depth configuration (default 1, the latest
+     *        message only), a depth of 0 follows the qos history depth (see SetQOS). The overflow
+     *        behavior follows the qos history kind.
+     *
      * @param [out] buf_    Standard string for copying message content.
      * @param [out] time_   Time from publisher in us (default = nullptr).
      * @param rcv_timeout_  Maximum time before receive operation returns (in milliseconds, -1 means infinite).
@@ -176,6 +181,20 @@ namespace eCAL
     **/
     size_t Receive(std::string& buf_, long long* time_ = nullptr, int rcv_timeout_ = 0) const;
 
+    /**
+     * @brief Receive a message and pass its content to a consumer without copying it.
+     *
+     *        The consumer is executed under the subscriber receive lock, the buffer is only
+     *        valid for the duration of the call (e.g. deserialize directly from it).
+     *
+     * @param consumer_     Consumer of the message buffer.
+     * @param [out] time_   Time from publisher in us (default = nullptr).
+     * @param rcv_timeout_  Maximum time before receive operation returns (in milliseconds, -1 means infinite).
+     *
+     * @return  True if a message was received and the consumer returned true.
+    **/
+    bool ReceiveInPlace(const ReceiveBufferT& consumer_, long long* time_ = nullptr, int rcv_timeout_ = 0) const;
+
     /**
      * @brief Add callback function for incoming receives. 
      *
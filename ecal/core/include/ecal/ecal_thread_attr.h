@@ -0,0 +1,106 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright (C) 2016 - 2019 Continental Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+/**
+ * @file   ecal_thread_attr.h
+ * @brief  eCAL internal thread attributes
+**/
+
+#pragma once
+
+#include <ecal/ecal_os.h>
+
+#include <string>
+#include <vector>
+
+#ifndef ECAL_C_DLL
+
+namespace eCAL
+{
+  namespace Thread
+  {
+    /**
+     * @brief eCAL internal thread classes.
+    **/
+    enum eThreadClass
+    {
+      thread_class_registration = 0,  //!< registration send and receive threads
+      thread_class_timeout,           //!< subscriber timeout check thread
+      thread_class_monitoring,        //!< monitoring receive and publish threads
+      thread_class_logging,           //!< logging drain thread
+      thread_class_udp_receive,       //!< udp (multicast, unicast, metal) and lcm receive threads
+      thread_class_shm_receive,       //!< shared memory receive threads
+      thread_class_service,           //!< service tcp server threads
+      thread_class_publisher,         //!< publisher batch flush threads
+      thread_class_callback,          //!< subscriber receive callback dispatch threads
+      thread_class_count
+    };
+
+    /**
+     * @brief eCAL thread scheduling policy.
+    **/
+    enum eSchedPolicy
+    {
+      sched_policy_other = 0,         //!< default time sharing scheduling (priority not changed)
+      sched_policy_fifo,              //!< real time first in first out scheduling
+      sched_policy_rr                 //!< real time round robin scheduling
+    };
+
+    /**
+     * @brief eCAL thread attributes.
+    **/
+    struct SThreadAttr
+    {
+      SThreadAttr()
+      {
+        policy   = sched_policy_other;
+        priority = 0;
+      }
+      eSchedPolicy      policy;       //!< scheduling policy
+      int               priority;     //!< scheduling priority (1 .. 99 for fifo and rr)
+      std::vector<int>  cpus;         //!< cpus the threads are pinned to (empty = not pinned)
+    };
+
+    /**
+     * @brief Set the attributes of an eCAL internal thread class.
+     *
+     *        The attributes overwrite the [thread] section of the
+     *        ecal.ini and are applied to threads started afterwards,
+     *        so they should be set before eCAL::Initialize.
+     *        Scheduling and cpu affinity are supported on linux only.
+     *
+     * @param class_  The thread class.
+     * @param attr_   The thread attributes.
+     *
+     * @return  True if succeeded.
+    **/
+    ECAL_API bool SetThreadAttr(eThreadClass class_, const SThreadAttr& attr_);
+
+    /**
+     * @brief Get the attributes of an eCAL internal thread class.
+     *
+     * @param class_  The thread class.
+     *
+     * @return  The thread attributes (set by api or configured in the ecal.ini).
+    **/
+    ECAL_API SThreadAttr GetThreadAttr(eThreadClass class_);
+  }
+}
+
+#endif /* ! ECAL_C_DLL */
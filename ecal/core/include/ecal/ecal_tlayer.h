@@ -55,6 +55,15 @@ namespace eCAL
       smode_auto
     };
 
+    /**
+     * @brief eCAL network layer payload compression.
+    **/
+    enum eCompression
+    {
+      compression_none = 0,
+      compression_lz4  = 1
+    };
+
     /**
      * @brief eCAL transport layer state struct.
     **/
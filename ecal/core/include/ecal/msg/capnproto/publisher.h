@@ -143,11 +143,10 @@ namespace eCAL
       **/
       bool Serialize(const T& msg_, char* buffer_, size_t size_) const
       {
-        kj::Array<capnp::word> words = capnp::messageToFlatArray(const_cast<T&>(msg_));
-        kj::ArrayPtr<kj::byte> bytes = words.asBytes();
-        if (size_ < bytes.size()) return(false);
-        memcpy(buffer_, bytes.begin(), bytes.size());
-        return(true);
+        // write the segments directly into the target buffer, no intermediate flat array
+        kj::ArrayOutputStream stream(kj::arrayPtr(reinterpret_cast<kj::byte*>(buffer_), size_));
+        capnp::writeMessage(stream, const_cast<T&>(msg_));
+        return(stream.getArray().size() == size_);
       }
     };
     /** @example addressbook_snd.cpp
@@ -36,6 +36,11 @@
 #pragma warning(pop)
 #endif
 
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <string>
+#include <vector>
 
 namespace eCAL
 {
@@ -136,6 +141,138 @@ namespace eCAL
         return(rest.size() == 0);
       }
     };
+
+    /**
+     * @brief  eCAL capnp zero copy subscriber class.
+     *
+     * Subscriber template class for a capnp struct type T. The callback gets a T::Reader
+     * of a FlatArrayMessageReader directly on the transport buffer, so reading the message
+     * does not copy it (only buffers not aligned to capnp words are copied once into an
+     * aligned buffer). The reader is only valid during the callback.
+     *
+    **/
+    template <typename T>
+    class CViewSubscriber : public eCAL::CSubscriber
+    {
+    public:
+      /**
+       * @brief capnp view receive callback function
+       *
+       * @param topic_name_  Topic name of the data source (publisher).
+       * @param msg_         Message reader.
+       * @param time_        Message time stamp.
+       * @param clock_       Message writer clock.
+       * @param id_          Message id.
+      **/
+      typedef std::function<void(const char* topic_name_, const typename T::Reader& msg_, long long time_, long long clock_, long long id_)> ViewReceiveCallbackT;
+
+      /**
+       * @brief  Constructor.
+      **/
+      CViewSubscriber() : eCAL::CSubscriber()
+      {
+      }
+
+      /**
+       * @brief  Constructor.
+       *
+       * @param topic_name_  Unique topic name.
+      **/
+      CViewSubscriber(const std::string& topic_name_) : eCAL::CSubscriber(topic_name_, GetTypeName(), "")
+      {
+      }
+
+      /**
+      * @brief  Copy Constructor is not available.
+      **/
+      CViewSubscriber(const CViewSubscriber&) = delete;
+
+      /**
+      * @brief  Copy Constructor is not available.
+      **/
+      CViewSubscriber& operator=(const CViewSubscriber&) = delete;
+
+      /**
+       * @brief  Creates this object.
+       *
+       * @param topic_name_  Unique topic name.
+       *
+       * @return  True if it succeeds, false if it fails.
+      **/
+      bool Create(const std::string& topic_name_)
+      {
+        return(eCAL::CSubscriber::Create(topic_name_, GetTypeName(), ""));
+      }
+
+      /**
+       * @brief  Get type name of the capnp message.
+       *
+       * @return  Type name.
+      **/
+      std::string GetTypeName() const
+      {
+        return("capnp:");
+      }
+
+      /**
+       * @brief  Add receive callback for incoming message readers.
+       *
+       * @param callback_  The callback function.
+       *
+       * @return  True if it succeeds, false if it fails.
+      **/
+      bool AddReceiveCallback(ViewReceiveCallbackT callback_)
+      {
+        m_cb_callback = callback_;
+        auto callback = std::bind(&CViewSubscriber::ReceiveCallback, this, std::placeholders::_1, std::placeholders::_2);
+        return(eCAL::CSubscriber::AddReceiveCallback(callback));
+      }
+
+      /**
+       * @brief  Remove receive callback for incoming message readers.
+       *
+       * @return  True if it succeeds, false if it fails.
+      **/
+      bool RemReceiveCallback()
+      {
+        bool ret = eCAL::CSubscriber::RemReceiveCallback();
+        m_cb_callback = nullptr;
+        return(ret);
+      }
+
+    private:
+      void ReceiveCallback(const char* topic_name_, const struct eCAL::SReceiveCallbackData* data_)
+      {
+        if(m_cb_callback == nullptr) return;
+        if(data_->buf == nullptr)    return;
+        if(data_->size < 1)          return;
+
+        const size_t words = static_cast<size_t>(data_->size) / sizeof(capnp::word);
+        const capnp::word* buf = reinterpret_cast<const capnp::word*>(data_->buf);
+        if(reinterpret_cast<std::uintptr_t>(data_->buf) % alignof(capnp::word) != 0)
+        {
+          // flat array reader requires word alignment
+          m_aligned_buf.resize(words);
+          memcpy(m_aligned_buf.data(), data_->buf, words * sizeof(capnp::word));
+          buf = m_aligned_buf.data();
+        }
+
+        // the message reader checks the segment table and bounds while reading,
+        // malformed buffers (on construction or on lazy field access in the
+        // callback) throw a kj::Exception and the sample is dropped
+        try
+        {
+          capnp::FlatArrayMessageReader reader(kj::arrayPtr(buf, words));
+          (m_cb_callback)(topic_name_, reader.getRoot<T>(), data_->time, data_->clock, data_->id);
+        }
+        catch(const kj::Exception&)
+        {
+        }
+      }
+
+      ViewReceiveCallbackT      m_cb_callback;
+      std::vector<capnp::word>  m_aligned_buf;
+    };
     /** @example addressbook_rec.cpp
     * This is an example how to use eCAL::CSubscriber to receive capnp data with eCAL. To send the data, see @ref addressbook_snd.cpp .
     */
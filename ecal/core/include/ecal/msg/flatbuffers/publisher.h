@@ -136,6 +136,22 @@ namespace eCAL
         memcpy(buffer_, msg_.GetBufferPointer(), msg_.GetSize());
         return(true);
       }
+
+      /**
+       * @brief  The finished builder already holds the serialized message, send it directly.
+       *
+       * @param       msg_     The message object.
+       * @param [out] buffer_  Builder buffer.
+       * @param [out] size_    Builder buffer size.
+       *
+       * @return  True.
+      **/
+      bool GetSerializedBuffer(const T& msg_, const void*& buffer_, size_t& size_) const
+      {
+        buffer_ = msg_.GetBufferPointer();
+        size_   = static_cast<size_t>(msg_.GetSize());
+        return(true);
+      }
     };
     /** @example monster_snd.cpp
     * This is an example how to use eCAL::CPublisher to send goggle::flatbuffers data with eCAL. To receive the data, see @ref monster_rec.cpp .
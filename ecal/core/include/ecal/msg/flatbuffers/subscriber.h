@@ -26,6 +26,11 @@
 
 #include <ecal/msg/subscriber.h>
 
+#include <flatbuffers/flatbuffers.h>
+
+#include <functional>
+#include <string>
+
 namespace eCAL
 {
   namespace flatbuffers
@@ -124,6 +129,121 @@ namespace eCAL
         return(true);
       }
     };
+
+    /**
+     * @brief  eCAL google::flatbuffers zero copy subscriber class.
+     *
+     * Subscriber template class for a flatbuffers root table type T. The buffer is verified
+     * and the callback gets a read only view (GetRoot<T>) directly on the transport buffer,
+     * so reading the message does not copy it. The view is only valid during the callback.
+     *
+    **/
+    template <typename T>
+    class CViewSubscriber : public eCAL::CSubscriber
+    {
+    public:
+      /**
+       * @brief flatbuffers view receive callback function
+       *
+       * @param topic_name_  Topic name of the data source (publisher).
+       * @param msg_         Read only message view.
+       * @param time_        Message time stamp.
+       * @param clock_       Message writer clock.
+       * @param id_          Message id.
+      **/
+      typedef std::function<void(const char* topic_name_, const T& msg_, long long time_, long long clock_, long long id_)> ViewReceiveCallbackT;
+
+      /**
+       * @brief  Constructor.
+      **/
+      CViewSubscriber() : eCAL::CSubscriber()
+      {
+      }
+
+      /**
+       * @brief  Constructor.
+       *
+       * @param topic_name_  Unique topic name.
+      **/
+      CViewSubscriber(const std::string& topic_name_) : eCAL::CSubscriber(topic_name_, GetTypeName(), "")
+      {
+      }
+
+      /**
+      * @brief  Copy Constructor is not available.
+      **/
+      CViewSubscriber(const CViewSubscriber&) = delete;
+
+      /**
+      * @brief  Copy Constructor is not available.
+      **/
+      CViewSubscriber& operator=(const CViewSubscriber&) = delete;
+
+      /**
+       * @brief  Creates this object.
+       *
+       * @param topic_name_  Unique topic name.
+       *
+       * @return  True if it succeeds, false if it fails.
+      **/
+      bool Create(const std::string& topic_name_)
+      {
+        return(eCAL::CSubscriber::Create(topic_name_, GetTypeName(), ""));
+      }
+
+      /**
+       * @brief  Get type name of the flatbuffers message.
+       *
+       * @return  Type name.
+      **/
+      std::string GetTypeName() const
+      {
+        return("flatb:");
+      }
+
+      /**
+       * @brief  Add receive callback for incoming message views.
+       *
+       * @param callback_  The callback function.
+       *
+       * @return  True if it succeeds, false if it fails.
+      **/
+      bool AddReceiveCallback(ViewReceiveCallbackT callback_)
+      {
+        m_cb_callback = callback_;
+        auto callback = std::bind(&CViewSubscriber::ReceiveCallback, this, std::placeholders::_1, std::placeholders::_2);
+        return(eCAL::CSubscriber::AddReceiveCallback(callback));
+      }
+
+      /**
+       * @brief  Remove receive callback for incoming message views.
+       *
+       * @return  True if it succeeds, false if it fails.
+      **/
+      bool RemReceiveCallback()
+      {
+        bool ret = eCAL::CSubscriber::RemReceiveCallback();
+        m_cb_callback = nullptr;
+        return(ret);
+      }
+
+    private:
+      void ReceiveCallback(const char* topic_name_, const struct eCAL::SReceiveCallbackData* data_)
+      {
+        if(m_cb_callback == nullptr) return;
+        if(data_->buf == nullptr)    return;
+        if(data_->size < 1)          return;
+
+        // verify the buffer before handing out a view on it
+        const uint8_t* buf = static_cast<const uint8_t*>(data_->buf);
+        ::flatbuffers::Verifier verifier(buf, static_cast<size_t>(data_->size));
+        if(!verifier.VerifyBuffer<T>(nullptr)) return;
+
+        (m_cb_callback)(topic_name_, *::flatbuffers::GetRoot<T>(buf), data_->time, data_->clock, data_->id);
+      }
+
+      ViewReceiveCallbackT m_cb_callback;
+    };
     /** @example monster_rec.cpp
     * This is an example how to use eCAL::CSubscriber to receive goggle::flatbuffers data with eCAL. To send the data, see @ref monster_snd.cpp .
     */
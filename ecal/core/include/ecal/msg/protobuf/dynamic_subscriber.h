@@ -251,13 +251,9 @@ namespace eCAL
 
     inline bool CDynamicSubscriber::Receive(google::protobuf::Message& msg_, long long* time_, int rcv_timeout_)
     {
-      std::string rec_buf;
-      size_t rec_len = msg_sub.Receive(rec_buf, time_, rcv_timeout_);
-      if (rec_len == 0) return(false);
-
-      // Parse current message content
-      auto parsed = msg_.ParseFromString(rec_buf);
-      return parsed;
+      // Parse current message content directly from the receive buffer
+      auto parse = [&msg_](const void* buf_, size_t size_) { return(msg_.ParseFromArray(buf_, static_cast<int>(size_))); };
+      return(msg_sub.ReceiveInPlace(parse, time_, rcv_timeout_));
     }
 
     inline bool CDynamicSubscriber::AddReceiveCallback(ProtoMsgCallbackT callback_)
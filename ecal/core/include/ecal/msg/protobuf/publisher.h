@@ -150,7 +150,10 @@ namespace eCAL
       **/
       bool Serialize(const T& msg_, char* buffer_, size_t size_) const
       {
-        return(msg_.SerializeToArray((void*)buffer_, (int)size_));
+        // sizes were cached by the preceding GetSize call, so do not walk the message twice
+        if (size_ < static_cast<size_t>(msg_.GetCachedSize())) return(false);
+        msg_.SerializeWithCachedSizesToArray(reinterpret_cast<google::protobuf::uint8*>(buffer_));
+        return(true);
       }
 
     };
@@ -142,6 +142,17 @@ namespace eCAL
         return(msg_.ParseFromArray(buffer_, static_cast<int>(size_)));
       }
 
+      /**
+       * @brief  ParseFromArray clears the message first, so one message object is reused for
+       *         all callbacks and keeps its allocated fields / repeated field capacities.
+       *
+       * @return  True.
+      **/
+      bool ReuseCallbackMessage() const
+      {
+        return(true);
+      }
+
     };
     /** @example person_rec.cpp
     * This is an example how to use eCAL::CSubscriber to receive google::protobuf data with eCAL. To send the data, see @ref person_snd.cpp .
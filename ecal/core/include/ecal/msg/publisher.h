@@ -29,6 +29,7 @@
 #include <string>
 #include <vector>
 #include <functional>
+#include <mutex>
 #include <assert.h>
 #include <string.h>
 
@@ -75,12 +76,22 @@ namespace eCAL
     /**
     * @brief  Move Constructor
     **/
-    CMsgPublisher(CMsgPublisher&&) = default;
+    CMsgPublisher(CMsgPublisher&& rhs)
+      : CPublisher(std::move(rhs))
+      , m_buffer(std::move(rhs.m_buffer))
+    {
+      // the buffer mutex is not moved, every publisher keeps its own
+    }
 
     /**
     * @brief  Move assignment
     **/
-    CMsgPublisher& operator=(CMsgPublisher&&) = default;
+    CMsgPublisher& operator=(CMsgPublisher&& rhs)
+    {
+      CPublisher::operator=(std::move(rhs));
+      m_buffer = std::move(rhs.m_buffer);
+      return *this;
+    }
 
     virtual ~CMsgPublisher() {}
 
@@ -128,27 +139,65 @@ namespace eCAL
         return(CPublisher::Send(nullptr, 0));
       }
 
+      // already serialized formats are sent directly
+      // from their own buffer without an additional copy
+      const void* msg_buf(nullptr);
+      size_t      msg_len(0);
+      if (GetSerializedBuffer(msg_, msg_buf, msg_len))
+      {
+        if (msg_len == 0) return(0);
+        return(CPublisher::Send(msg_buf, msg_len, time_));
+      }
+
       // if we have a subscription allocate memory for the
       // binary stream, serialize the message into the
       // buffer and finally send it with a binary publisher
+      // (the cached buffer is taken out under the lock only, a concurrent
+      //  send finds it empty and serializes into its own buffer)
+      std::vector<char> buffer;
+      {
+        std::lock_guard<std::mutex> lock(m_buffer_sync);
+        buffer.swap(m_buffer);
+      }
+
+      size_t sent(0);
       size_t size = GetSize(msg_);
       if(size > 0)
       {
-        m_buffer.resize(size);
-        if(Serialize(msg_, &m_buffer[0], m_buffer.size()))
+        buffer.resize(size);
+        if(Serialize(msg_, &buffer[0], buffer.size()))
         {
-          return(CPublisher::Send(&m_buffer[0], size, time_));
+          sent = CPublisher::Send(&buffer[0], size, time_);
         }
       }
-      return(0);
+
+      // hand the buffer back for reuse, keep the larger one
+      {
+        std::lock_guard<std::mutex> lock(m_buffer_sync);
+        if(buffer.capacity() > m_buffer.capacity()) m_buffer.swap(buffer);
+      }
+      return(sent);
     }
 
+  protected:
+    std::mutex        m_buffer_sync;  // protects the buffer handover only, not the send
+    std::vector<char> m_buffer;
+
   private:
     virtual std::string GetTypeName() const = 0;
     virtual std::string GetDescription() const = 0;
     virtual size_t GetSize(const T& msg_) const = 0;
     virtual bool Serialize(const T& msg_, char* buffer_, size_t size_) const = 0;
 
-    std::vector<char> m_buffer;
+    /**
+     * @brief  Get the buffer of an already serialized message object (default: not supported).
+     *
+     * @param       msg_     The message object.
+     * @param [out] buffer_  Serialized message buffer.
+     * @param [out] size_    Serialized message size.
+     *
+     * @return  True if the message exposes its serialized buffer, false if it needs to be serialized.
+    **/
+    virtual bool GetSerializedBuffer(const T& /*msg_*/, const void*& /*buffer_*/, size_t& /*size_*/) const { return(false); }
   };
 }
\ No newline at end of file
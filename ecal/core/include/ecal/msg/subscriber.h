@@ -30,6 +30,7 @@
 #include <string>
 #include <vector>
 #include <functional>
+#include <memory>
 #include <assert.h>
 #include <string.h>
 
@@ -155,10 +156,9 @@ namespace eCAL
     bool Receive(T& msg_, long long* time_ = nullptr, int rcv_timeout_ = 0) const
     {
       assert(IsCreated());
-      std::string rec_buf;
-      size_t rec_len = CSubscriber::Receive(rec_buf, time_, rcv_timeout_);
-      if(rec_len == 0) return(false);
-      return(Deserialize(msg_, rec_buf.c_str(), rec_buf.size()));
+      // deserialize directly from the subscriber receive buffer
+      auto deserialize = [this, &msg_](const void* buf_, size_t size_) { return(Deserialize(msg_, buf_, size_)); };
+      return(CSubscriber::ReceiveInPlace(deserialize, time_, rcv_timeout_));
     }
 
     /**
@@ -207,6 +207,13 @@ namespace eCAL
     virtual std::string GetDescription() const = 0;
     virtual bool Deserialize(T& msg_, const void* buffer_, size_t size_) const = 0;
 
+    /**
+     * @brief  Reuse one message object for all receive callbacks instead of constructing one per message.
+     *
+     * Only valid if Deserialize completely resets the message object.
+    **/
+    virtual bool ReuseCallbackMessage() const { return(false); }
+
     void ReceiveCallback(const char* topic_name_, const struct eCAL::SReceiveCallbackData* data_)
     {
       if(m_cb_active == false) return;
@@ -214,17 +221,31 @@ namespace eCAL
       if(data_->buf == nullptr) return;
       if(data_->size < 1)       return;
 
-      T msg;
-      if(Deserialize(msg, data_->buf, data_->size))
+      if(ReuseCallbackMessage())
+      {
+        if(!m_cb_msg) m_cb_msg = std::make_shared<T>();
+        ExecuteCallback(topic_name_, *m_cb_msg, data_);
+      }
+      else
+      {
+        T msg;
+        ExecuteCallback(topic_name_, msg, data_);
+      }
+    }
+
+    void ExecuteCallback(const char* topic_name_, T& msg_, const struct eCAL::SReceiveCallbackData* data_)
+    {
+      if(Deserialize(msg_, data_->buf, data_->size))
       {
         if(m_cb_callback != nullptr)
         {
-          (m_cb_callback)(topic_name_, msg, data_->time, data_->clock, data_->id);
+          (m_cb_callback)(topic_name_, msg_, data_->time, data_->clock, data_->id);
         }
       }
     }
 
     bool                 m_cb_active;
     MsgReceiveCallbackT  m_cb_callback;
+    std::shared_ptr<T>   m_cb_msg;
   };
 }
@@ -0,0 +1,174 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright (C) 2016 - 2019 Continental Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+/**
+ * @brief  eCAL bounded lock free queue
+**/
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+namespace eCAL
+{
+  namespace Util
+  {
+    /**
+    * @brief A bounded lock free multi producer / multi consumer queue.
+    *
+    * Elements are preallocated and filled / consumed in place, so that
+    * pushing and popping does not allocate once the element buffers
+    * (e.g. std::string capacities) are warmed up. Push never blocks,
+    * it returns false if the queue is full.
+    **/
+    template<class T>
+    class CBoundedQueue
+    {
+    public:
+      explicit CBoundedQueue(size_t capacity_) :
+        m_capacity(RoundUpPow2(capacity_)),
+        m_mask(m_capacity - 1),
+        m_cells(new SCell[m_capacity]),
+        m_enqueue_pos(0),
+        m_dequeue_pos(0)
+      {
+        for (size_t i = 0; i < m_capacity; ++i)
+        {
+          m_cells[i].sequence.store(i, std::memory_order_relaxed);
+        }
+      };
+
+      /**
+      * @brief  push an element, fill_ is called with a reference to the reserved slot
+      *
+      * @return  false if the queue is full
+      **/
+      template<class FillT>
+      bool push(FillT fill_)
+      {
+        SCell* cell = nullptr;
+        size_t pos  = m_enqueue_pos.load(std::memory_order_relaxed);
+        for (;;)
+        {
+          cell = &m_cells[pos & m_mask];
+          const size_t   seq = cell->sequence.load(std::memory_order_acquire);
+          const intptr_t dif = static_cast<intptr_t>(seq) - static_cast<intptr_t>(pos);
+          if (dif == 0)
+          {
+            if (m_enqueue_pos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) break;
+          }
+          else if (dif < 0)
+          {
+            // queue full
+            return(false);
+          }
+          else
+          {
+            pos = m_enqueue_pos.load(std::memory_order_relaxed);
+          }
+        }
+
+        fill_(cell->data);
+        cell->sequence.store(pos + 1, std::memory_order_release);
+        return(true);
+      };
+
+      /**
+      * @brief  pop an element, consume_ is called with a reference to the oldest slot
+      *
+      * @return  false if the queue is empty
+      **/
+      template<class ConsumeT>
+      bool pop(ConsumeT consume_)
+      {
+        SCell* cell = nullptr;
+        size_t pos  = m_dequeue_pos.load(std::memory_order_relaxed);
+        for (;;)
+        {
+          cell = &m_cells[pos & m_mask];
+          const size_t   seq = cell->sequence.load(std::memory_order_acquire);
+          const intptr_t dif = static_cast<intptr_t>(seq) - static_cast<intptr_t>(pos + 1);
+          if (dif == 0)
+          {
+            if (m_dequeue_pos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) break;
+          }
+          else if (dif < 0)
+          {
+            // queue empty
+            return(false);
+          }
+          else
+          {
+            pos = m_dequeue_pos.load(std::memory_order_relaxed);
+          }
+        }
+
+        consume_(cell->data);
+        cell->sequence.store(pos + m_mask + 1, std::memory_order_release);
+        return(true);
+      };
+
+      // (approximate) number of queued elements
+      size_t size() const
+      {
+        const size_t enq = m_enqueue_pos.load(std::memory_order_relaxed);
+        const size_t deq = m_dequeue_pos.load(std::memory_order_relaxed);
+        return(enq > deq ? enq - deq : 0);
+      };
+
+      bool empty() const
+      {
+        return(size() == 0);
+      };
+
+      size_t capacity() const
+      {
+        return(m_capacity);
+      };
+
+    private:
+      CBoundedQueue(const CBoundedQueue&);             // prevent copy-construction
+      CBoundedQueue& operator=(const CBoundedQueue&);  // prevent assignment
+
+      static size_t RoundUpPow2(size_t val_)
+      {
+        size_t cap = 2;
+        while (cap < val_) cap <<= 1;
+        return(cap);
+      };
+
+      struct SCell
+      {
+        std::atomic<size_t> sequence;
+        T                   data;
+      };
+
+      const size_t                m_capacity;
+      const size_t                m_mask;
+      std::unique_ptr<SCell[]>    m_cells;
+
+      // keep producer and consumer positions on separate cache lines
+      alignas(64) std::atomic<size_t> m_enqueue_pos;
+      alignas(64) std::atomic<size_t> m_dequeue_pos;
+    };
+  }
+}
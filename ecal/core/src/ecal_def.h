@@ -44,6 +44,8 @@
 /**********************************************************************************************/
 /* timeout for automatic removing monitoring topics in ms */
 #define MON_TIMEOUT                                 5000
+/* minimum time between two monitoring delta updates of an entity caused by its live statistics only in ms */
+#define MON_STATS_INTERVAL                          1000
 /* topics blacklist as regular expression (will not be monitored) */
 #define MON_FILTER_EXCL                            "_.*"
 /* topics whitelist as regular expression (will be monitored only) */
@@ -54,6 +56,15 @@
 #define MON_LOG_FILTER_FILE                        ""
 #define MON_LOG_FILTER_UDP                         "info,warning,error,fatal"
 
+/* logging queue size (messages are dropped and counted if the queue is full) */
+#define MON_LOG_QUEUE_SIZE                          4096
+/* logging queue drain period in ms */
+#define MON_LOG_DRAIN_PERIOD                        20
+/* maximum size of a batched logging udp datagram in bytes */
+#define MON_LOG_UDP_BATCH_SIZE                     (32*1024)
+/* send batched logging udp datagrams    [on = 1, off = 0] (receivers older than the batching only decode single messages) */
+#define MON_LOG_UDP_BATCH                              0
+
 /**********************************************************************************************/
 /*                                     network settings                                       */
 /**********************************************************************************************/
@@ -144,6 +155,11 @@
 /* reserve buffer size before reallocation in % */
 #define PUB_MEMFILE_RESERVE                           50
 
+/* memory file placement (linux only), huge pages and populate [on = 1, off = 0], numa node [-1 = no binding] */
+#define PUB_MEMFILE_HUGE_PAGES                         0
+#define PUB_MEMFILE_POPULATE                           0
+#define PUB_MEMFILE_NUMA_NODE                         -1
+
 /* timeout for create / open a memory file using mutex lock in ms */
 #define PUB_MEMFILE_CREATE_TO                        200
 #define PUB_MEMFILE_OPEN_TO                           50
@@ -152,11 +168,42 @@
 #define PUB_MEMFILE_ACK_TO_QOS_BE                     10   /* qos: best effort */
 #define PUB_MEMFILE_ACK_TO_QOS_RE                    100   /* qos: reliable    */
 
+/* maximum number of subscriber processes acknowledging a memory file broadcast (linux) */
+#define PUB_MEMFILE_BC_READERS                        64
+
+/* shm layer parameter of subscribers following the memory file broadcast (they need no per process events) */
+#define PUB_MEMFILE_BC_READER_PAR                     "broadcast"
+
+/* minimum payload size in bytes for udp payload compression (smaller samples are sent uncompressed) */
+#define PUB_UDP_COMPRESSION_MINSIZE                  256
+
+/**********************************************************************************************/
+/*                                     subscriber settings                                    */
+/**********************************************************************************************/
+/* number of receive callback dispatch threads (0 = execute callbacks on the transport thread) */
+#define SUB_CALLBACK_THREADS                           0
+/* number of samples a subscriber can queue for callback dispatching */
+#define SUB_CALLBACK_QUEUE_SIZE                      256
+/* dispatch queue overflow policy    [drop oldest = 1, drop newest = 0] */
+#define SUB_CALLBACK_OVERFLOW                          0
+/* number of samples a subscriber queues for polling receive calls (0 = qos history depth) */
+#define SUB_RECEIVE_QUEUE_DEPTH                        1
+
 /**********************************************************************************************/
 /*                                     time settings                                          */
 /**********************************************************************************************/
 #define TIME_SYNC_MOD_RT                              ""
 #define TIME_SYNC_MOD_REPLAY                          ""
+/* refresh period of the cached realtime module clock offset in ms [0 = call module for every timestamp] */
+#define TIME_FASTCLOCK_REFRESH                        100
+
+/**********************************************************************************************/
+/*                                     thread settings                                        */
+/**********************************************************************************************/
+/* internal thread scheduling policy [other, fifo, rr], priority and cpu list (e.g. "2,3" or "4-7", "" = not pinned) */
+#define THREAD_POLICY                            "other"
+#define THREAD_PRIORITY                                0
+#define THREAD_CPUS                                   ""
 
 /**********************************************************************************************/
 /*                                     process settings                                       */
@@ -172,9 +219,15 @@
 /* time for resend registration info from publisher/subscriber in ms */
 #define CMN_REGISTRATION_REFRESH                    1000
 
+/* minimum time between two forced (coalesced) registration bursts in ms */
+#define CMN_REGISTRATION_FORCE_MIN_DELAY               5
+
 /* delta time to check timeout for data readers in ms */
 #define CMN_DATAREADER_TIMEOUT_DTIME                  10
 
+/* number of trace events per thread ring buffer (only used if built with ECAL_CORE_TRACE) */
+#define CMN_TRACE_BUFFER_SIZE                      16384
+
 /**********************************************************************************************/
 /*                                     events                                                 */
 /**********************************************************************************************/
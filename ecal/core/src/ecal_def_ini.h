@@ -70,6 +70,15 @@
 #define  TIME_SECTION_S                   "time"
 #define  TIME_SYNC_MOD_RT_S               "timesync_module_rt"
 #define  TIME_SYNC_MOD_REPLAY_S           "timesync_module_replay"
+#define  TIME_FASTCLOCK_REFRESH_S         "fastclock_refresh"
+
+/////////////////////////////////////
+// thread
+/////////////////////////////////////
+#define  THREAD_SECTION_S                 "thread"
+#define  THREAD_POLICY_S                  "_policy"
+#define  THREAD_PRIORITY_S                "_priority"
+#define  THREAD_CPUS_S                    "_cpus"
 
 /////////////////////////////////////
 // process
@@ -83,12 +92,14 @@
 #define  MON_SECTION_S                    "monitoring"
 
 #define  MON_TIMEOUT_S                    "timeout"
+#define  MON_STATS_INTERVAL_S             "stats_interval"
 #define  MON_FILTER_EXCL_S                "filter_excl"
 #define  MON_FILTER_INCL_S                "filter_incl"
 
 #define  MON_LOG_FILTER_CON_S             "filter_log_con"
 #define  MON_LOG_FILTER_FILE_S            "filter_log_file"
 #define  MON_LOG_FILTER_UDP_S             "filter_log_udp"
+#define  MON_LOG_UDP_BATCH_S              "log_udp_batch"
 
 /////////////////////////////////////
 // sys
@@ -116,8 +127,21 @@
 
 #define  PUB_MEMFILE_MINSIZE_S            "memfile_minsize"
 #define  PUB_MEMFILE_RESERVE_S            "memfile_reserve"
+#define  PUB_MEMFILE_HUGE_PAGES_S         "memfile_huge_pages"
+#define  PUB_MEMFILE_POPULATE_S           "memfile_populate"
+#define  PUB_MEMFILE_NUMA_NODE_S          "memfile_numa_node"
 #define  PUB_MEMFILE_ACK_TO_QOS_BE_S      "memfile_ack_timeout_qos_1"
 #define  PUB_MEMFILE_ACK_TO_QOS_RE_S      "memfile_ack_timeout_qos_2"
 
 #define  PUB_SHARE_TTYPE_S                "share_ttype"
 #define  PUB_SHARE_TDESC_S                "share_tdesc"
+
+/////////////////////////////////////
+// subscriber
+/////////////////////////////////////
+#define  SUB_SECTION_S                    "subscriber"
+
+#define  SUB_CALLBACK_THREADS_S           "callback_threads"
+#define  SUB_CALLBACK_QUEUE_SIZE_S        "callback_queue_size"
+#define  SUB_CALLBACK_OVERFLOW_S          "callback_overflow"
+#define  SUB_RECEIVE_QUEUE_DEPTH_S        "receive_queue_depth"
@@ -26,6 +26,8 @@
 
 #include <ecal/ecal_event.h>
 
+#include "ecal_trace.h"
+
 #include <sstream>
 #include <memory>
 #include <chrono>
@@ -60,12 +62,14 @@ namespace eCAL
   bool gSetEvent(const EventHandleT& event_)
   {
     if(!event_.handle) return(false);
+    ECAL_TRACE_INSTANT(probe_event_set, 0);
     return(::SetEvent(event_.handle) != 0);
   }
 
   bool gWaitForEvent(const EventHandleT& event_, const long timeout_)
   {
     if(!event_.handle) return(false);
+    ECAL_TRACE_SCOPE(probe_event_wait, timeout_);
     if(timeout_ < 0)
     {
       return(::WaitForSingleObject(event_.handle, INFINITE) == WAIT_OBJECT_0);
@@ -405,6 +409,7 @@ namespace eCAL
   bool gSetEvent(const EventHandleT& event_)
   {
     if(!event_.handle) return false;
+    ECAL_TRACE_INSTANT(probe_event_set, 0);
     if(event_.name.empty())
     {
       static_cast<CEvent*>(event_.handle)->set();
@@ -419,6 +424,7 @@ namespace eCAL
   bool gWaitForEvent(const EventHandleT& event_, const long timeout_)
   {
     if(!event_.handle) return false;
+    ECAL_TRACE_SCOPE(probe_event_wait, timeout_);
     if(event_.name.empty())
     {
       if(timeout_ < 0)
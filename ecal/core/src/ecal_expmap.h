@@ -219,6 +219,22 @@ namespace eCAL
         }
       };
 
+      // Purge the timed out elements from the cache and return them
+      void remove_deprecated(std::list<std::pair<Key, T>>* elem_erased)
+      {
+        clock_type::time_point eviction_limit = get_curr_time() - _timeout;
+
+        auto it(_key_tracker.begin());
+
+        while (it != _key_tracker.end() && it->first < eviction_limit)
+        {
+          auto vit = _key_to_value.find(it->second);
+          if (elem_erased != nullptr) elem_erased->push_back(std::make_pair(vit->first, vit->second.first));
+          _key_to_value.erase(vit);        // erase the element from the map
+          it = _key_tracker.erase(it);     // erase the element from the list
+        }
+      };
+
       // Remove all elements from the cache 
       void clear()
       {
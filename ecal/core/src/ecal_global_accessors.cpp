@@ -125,6 +125,12 @@ namespace eCAL
     return(g_globals()->memfile_pool().get());
   }
 
+  CReaderDispatcher* g_reader_dispatcher()
+  {
+    if (!g_globals()) return(nullptr);
+    return(g_globals()->reader_dispatcher().get());
+  }
+
   SMemFileMap* g_memfile_map()
   {
     if (!g_globals()) return(nullptr);
@@ -43,6 +43,7 @@ namespace eCAL
   class  CServGate;
   class  CRegGate;
   class  CMemFileThreadPool;
+  class  CReaderDispatcher;
   struct SMemFileMap;
 
   // Declaration of getter functions for globally accessible variable instances
@@ -58,6 +59,7 @@ namespace eCAL
   CServGate*             g_servgate();
   CRegGate*              g_reggate();
   CMemFileThreadPool*    g_memfile_pool();
+  CReaderDispatcher*     g_reader_dispatcher();
   SMemFileMap*           g_memfile_map();
 
   // declaration of globally accessible variables
@@ -24,6 +24,7 @@
 #include "ecal_globals.h"
 #include "io/udp_init.h"
 #include "ecal_config.h"
+#include "ecal_trace.h"
 
 namespace eCAL
 {
@@ -112,6 +113,11 @@ namespace eCAL
         subgate_instance = std::unique_ptr<CSubGate>(new CSubGate);
         new_initialization = true;
       }
+      if (reader_dispatcher_instance == nullptr)
+      {
+        reader_dispatcher_instance = std::unique_ptr<CReaderDispatcher>(new CReaderDispatcher);
+        new_initialization = true;
+      }
     }
 
     /////////////////////
@@ -183,6 +189,7 @@ namespace eCAL
     if (descgate_instance)                                        descgate_instance->Create();
     if (reggate_instance)                                         reggate_instance->Create();
     if (memfile_pool_instance)                                    memfile_pool_instance->Create();
+    if (reader_dispatcher_instance && (components_ & Init::Subscriber)) reader_dispatcher_instance->Create();
     if (subgate_instance && (components_ & Init::Subscriber))     subgate_instance->Create();
     if (pubgate_instance && (components_ & Init::Publisher))      pubgate_instance->Create();
     if (servgate_instance && (components_ & Init::Service))       servgate_instance->Create();
@@ -227,12 +234,18 @@ namespace eCAL
   {
     if (!initialized) return(1);
 
+#ifdef ECAL_CORE_TRACE
+    // write out trace events
+    Trace::ExportToLogPath();
+#endif
+
     // start destruction
     if (monitoring_instance)       monitoring_instance->Destroy();
     if (timegate_instance)         timegate_instance->Destroy();
     if (servgate_instance)         servgate_instance->Destroy();
     if (pubgate_instance)          pubgate_instance->Destroy();
     if (subgate_instance)          subgate_instance->Destroy();
+    if (reader_dispatcher_instance) reader_dispatcher_instance->Destroy();
     if (reggate_instance)          reggate_instance->Destroy();
     if (descgate_instance)         descgate_instance->Destroy();
     if (entity_register_instance)  entity_register_instance->Destroy();
@@ -245,6 +258,7 @@ namespace eCAL
     servgate_instance         = nullptr;
     pubgate_instance          = nullptr;
     subgate_instance          = nullptr;
+    reader_dispatcher_instance = nullptr;
     reggate_instance          = nullptr;
     descgate_instance         = nullptr;
     entity_register_instance  = nullptr;
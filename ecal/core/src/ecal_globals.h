@@ -34,6 +34,7 @@
 #include "mon/ecal_monitoring_def.h"
 #include "pubsub/ecal_pubgate.h"
 #include "pubsub/ecal_subgate.h"
+#include "readwrite/ecal_reader_dispatch.h"
 
 #include <memory>
 
@@ -62,6 +63,7 @@ namespace eCAL
     const std::unique_ptr<CRegGate>&                                      reggate()          { return reggate_instance; };
     const std::unique_ptr<CMemFileThreadPool>&                            memfile_pool()     { return memfile_pool_instance; };
     const std::unique_ptr<SMemFileMap>                   &                memfile_map()      { return memfile_map_instance; };
+    const std::unique_ptr<CReaderDispatcher>&                             reader_dispatcher(){ return reader_dispatcher_instance; };
 
   private:
     bool                                                                  initialized;
@@ -77,5 +79,6 @@ namespace eCAL
     std::unique_ptr<CRegGate>                                             reggate_instance;
     std::unique_ptr<CMemFileThreadPool>                                   memfile_pool_instance;
     std::unique_ptr<SMemFileMap>                                          memfile_map_instance;
+    std::unique_ptr<CReaderDispatcher>                                    reader_dispatcher_instance;
   };
 }
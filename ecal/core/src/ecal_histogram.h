@@ -0,0 +1,153 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright (C) 2016 - 2019 Continental Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+/**
+ * @brief  eCAL lock free value histogram
+**/
+
+#pragma once
+
+#include <atomic>
+#include <limits>
+
+namespace eCAL
+{
+  namespace Util
+  {
+    /**
+    * @brief A lock free log-linear histogram (HDR style) for non negative integer values.
+    *
+    * Every power of two range is split into 4 linear sub buckets, so the relative
+    * bucket error is below 25 %. Values above 2^40 are counted in the last bucket.
+    * Add can be called concurrently from multiple threads, readers get a
+    * consistent enough view for statistics without locking.
+    **/
+    class CHistogram
+    {
+    public:
+      static const int sub_bucket_bits  = 2;
+      static const int sub_bucket_count = 1 << sub_bucket_bits;
+      static const int max_value_bits   = 40;
+      static const int bucket_count     = (max_value_bits - sub_bucket_bits + 1) * sub_bucket_count;
+
+      CHistogram()
+      {
+        Reset();
+      };
+
+      void Reset()
+      {
+        for (int i = 0; i < bucket_count; ++i) m_buckets[i].store(0, std::memory_order_relaxed);
+        m_count.store(0, std::memory_order_relaxed);
+        m_sum.store(0, std::memory_order_relaxed);
+        m_min.store((std::numeric_limits<long long>::max)(), std::memory_order_relaxed);
+        m_max.store(0, std::memory_order_relaxed);
+      };
+
+      void Add(long long value_)
+      {
+        if (value_ < 0) value_ = 0;
+
+        m_buckets[BucketIndex(value_)].fetch_add(1, std::memory_order_relaxed);
+        m_count.fetch_add(1, std::memory_order_relaxed);
+        m_sum.fetch_add(value_, std::memory_order_relaxed);
+
+        long long cur_min = m_min.load(std::memory_order_relaxed);
+        while ((value_ < cur_min) && !m_min.compare_exchange_weak(cur_min, value_, std::memory_order_relaxed)) {}
+        long long cur_max = m_max.load(std::memory_order_relaxed);
+        while ((value_ > cur_max) && !m_max.compare_exchange_weak(cur_max, value_, std::memory_order_relaxed)) {}
+      };
+
+      long long Count() const { return(m_count.load(std::memory_order_relaxed)); };
+      long long Sum()   const { return(m_sum.load(std::memory_order_relaxed)); };
+      long long Min()   const { return(Count() > 0 ? m_min.load(std::memory_order_relaxed) : 0); };
+      long long Max()   const { return(m_max.load(std::memory_order_relaxed)); };
+      long long Mean()  const { const long long cnt = Count(); return(cnt > 0 ? Sum() / cnt : 0); };
+
+      long long BucketCount(int index_) const { return(m_buckets[index_].load(std::memory_order_relaxed)); };
+
+      // highest value counted in the bucket with the given index
+      static long long BucketUpperBound(int index_)
+      {
+        if (index_ < sub_bucket_count) return(index_);
+        const int       shift = index_ / sub_bucket_count - 1;
+        const long long lower = static_cast<long long>(sub_bucket_count + index_ % sub_bucket_count) << shift;
+        return(lower + (1LL << shift) - 1);
+      };
+
+      /**
+      * @brief  get the value below which the given fraction (0.0 .. 1.0) of samples fall
+      *
+      * @return  upper bound of the matching bucket (limited to the maximum value)
+      **/
+      long long Percentile(double fraction_) const
+      {
+        const long long cnt = Count();
+        if (cnt == 0) return(0);
+
+        long long rank = static_cast<long long>(fraction_ * static_cast<double>(cnt) + 0.5);
+        if (rank < 1)   rank = 1;
+        if (rank > cnt) rank = cnt;
+
+        long long acc(0);
+        for (int i = 0; i < bucket_count; ++i)
+        {
+          acc += BucketCount(i);
+          if (acc >= rank)
+          {
+            const long long bound = BucketUpperBound(i);
+            const long long max   = Max();
+            return(bound < max ? bound : max);
+          }
+        }
+        return(Max());
+      };
+
+    private:
+      CHistogram(const CHistogram&);             // prevent copy-construction
+      CHistogram& operator=(const CHistogram&);  // prevent assignment
+
+      static int BucketIndex(long long value_)
+      {
+        if (value_ < sub_bucket_count) return(static_cast<int>(value_));
+
+        // index of the most significant bit
+        int msb(0);
+        unsigned long long v = static_cast<unsigned long long>(value_);
+        if (v >= (1ULL << 32)) { v >>= 32; msb += 32; }
+        if (v >= (1ULL << 16)) { v >>= 16; msb += 16; }
+        if (v >= (1ULL <<  8)) { v >>=  8; msb +=  8; }
+        if (v >= (1ULL <<  4)) { v >>=  4; msb +=  4; }
+        if (v >= (1ULL <<  2)) { v >>=  2; msb +=  2; }
+        if (v >= (1ULL <<  1)) {           msb +=  1; }
+        if (msb >= max_value_bits) return(bucket_count - 1);
+
+        const int shift = msb - sub_bucket_bits;
+        const int sub   = static_cast<int>((value_ >> shift) & (sub_bucket_count - 1));
+        return((shift + 1) * sub_bucket_count + sub);
+      };
+
+      std::atomic<long long> m_buckets[bucket_count];
+      std::atomic<long long> m_count;
+      std::atomic<long long> m_sum;
+      std::atomic<long long> m_min;
+      std::atomic<long long> m_max;
+    };
+  }
+}
@@ -45,15 +45,6 @@
 #include <ctime>
 #include <chrono>
 
-#ifdef _MSC_VER
-#pragma warning(push)
-#pragma warning(disable: 4146 4800)
-#endif
-#include "ecal/pb/monitoring.pb.h"
-#ifdef _MSC_VER
-#pragma warning(pop)
-#endif
-
 #ifdef ECAL_OS_WINDOWS
 #include "ecal_win_main.h"
 
@@ -134,11 +125,40 @@ static void tokenize(const std::string& str, std::vector<std::string>& tokens,
   }
 }
 
+static const char* level_str(const eCAL_Logging_eLogLevel level_)
+{
+  switch(level_)
+  {
+  case log_level_info:
+    return("info");
+  case log_level_warning:
+    return("warning");
+  case log_level_error:
+    return("error");
+  case log_level_fatal:
+    return("fatal");
+  case log_level_debug1:
+    return("debug1");
+  case log_level_debug2:
+    return("debug2");
+  case log_level_debug3:
+    return("debug3");
+  case log_level_debug4:
+    return("debug4");
+  default:
+    return("");
+  }
+}
+
 namespace eCAL
 {
   CLog::CLog() :
           m_created(false),
           m_udp_sender(new CUDPSender()),
+          m_log_queue(MON_LOG_QUEUE_SIZE),
+          m_log_dropped(0),
+          m_udp_batch_enabled(false),
+          m_udp_batch_size(0),
           m_pid(0),
           m_logfile(nullptr),
           m_level(log_level_none),
@@ -167,6 +187,9 @@ namespace eCAL
     m_filter_mask_file = ParseLogLevel(eCALPAR(MON, LOG_FILTER_FILE));
     m_filter_mask_udp  = ParseLogLevel(eCALPAR(MON, LOG_FILTER_UDP));
 
+    // batched udp datagrams can only be decoded by receivers knowing them
+    m_udp_batch_enabled = eCALPAR(MON, LOG_UDP_BATCH);
+
     // create log file
     if(m_filter_mask_file)
     {
@@ -193,19 +216,25 @@ namespace eCAL
       m_udp_sender->Create(attr);
     }
 
+    // start queue drain thread
+    m_drain_thread.Start(MON_LOG_DRAIN_PERIOD, std::bind(&CLog::DrainQueue, this), Thread::thread_class_logging, "ecal_log_drain");
+
     m_created = true;
   }
 
   void CLog::Destroy()
   {
     if(!m_created) return;
+    m_created = false;
+
+    // stop drain thread and write out pending messages
+    m_drain_thread.Stop();
+    DrainQueue();
 
     m_udp_sender->Destroy();
 
     if(m_logfile) fclose(m_logfile);
     m_logfile = nullptr;
-
-    m_created = false;
   }
 
   char CLog::ParseLogLevel(const std::string& filter_)
@@ -232,103 +261,179 @@ namespace eCAL
 
   void CLog::SetLogLevel(const eCAL_Logging_eLogLevel level_)
   { 
-    std::lock_guard<std::mutex> lock(m_log_sync);
     m_level = level_;
   };
 
   eCAL_Logging_eLogLevel CLog::GetLogLevel()
   { 
-    std::lock_guard<std::mutex> lock(m_log_sync);
     return(m_level);
   };
 
   void CLog::Log(const eCAL_Logging_eLogLevel level_, const std::string& msg_)
   {
-    std::lock_guard<std::mutex> lock(m_log_sync);
-
     if(!m_created) return;
     if(msg_.empty()) return;
 
-    char log_con  = level_ & m_filter_mask_con;
-    char log_file = level_ & m_filter_mask_file;
-    char log_udp  = level_ & m_filter_mask_udp;
-    if(!(log_con | log_file | log_udp)) return;
+    if(!(level_ & (m_filter_mask_con | m_filter_mask_file | m_filter_mask_udp))) return;
 
-    static eCAL::pb::LogMessage ecal_msg;
-    static std::string        ecal_msg_s;
-    auto                      log_time = eCAL::Time::ecal_clock::now();
+    const long long log_time = std::chrono::duration_cast<std::chrono::microseconds>(eCAL::Time::ecal_clock::now().time_since_epoch()).count();
 
-    if(log_con)
+    // fatal messages are written out synchronously (after all pending ones)
+    // so they are not lost if the process aborts right after logging them
+    if(level_ == log_level_fatal)
     {
-      std::cout << msg_ << std::endl;
+      std::lock_guard<std::mutex> lock(m_drain_sync);
+      DrainEntries();
+
+      SLogEntry entry;
+      entry.level   = level_;
+      entry.time    = log_time;
+      entry.content = msg_;
+      WriteEntry(entry);
+
+      FlushBatch();
+      return;
     }
 
-    if(log_file && m_logfile)
+    // queue the message, the calling thread is never blocked
+    // by console, file or network output
+    const bool queued = m_log_queue.push([&](SLogEntry& entry_)
+    {
+      entry_.level = level_;
+      entry_.time  = log_time;
+      entry_.content.assign(msg_);
+    });
+
+    // queue overflow, drop the message and count it
+    if(!queued) m_log_dropped++;
+  }
+
+  int CLog::DrainQueue()
+  {
+    std::lock_guard<std::mutex> lock(m_drain_sync);
+
+    DrainEntries();
+
+    // write batches
+    FlushBatch();
+
+    return(0);
+  }
+
+  void CLog::DrainEntries()
+  {
+    // drain at most one queue capacity per cycle
+    size_t cnt(0);
+    while((cnt < m_log_queue.capacity()) && m_log_queue.pop([this](SLogEntry& entry_) { WriteEntry(entry_); }))
     {
-      std::stringstream msg_stream;
-      msg_stream << std::chrono::duration_cast<std::chrono::milliseconds>(log_time.time_since_epoch()).count();
-      msg_stream << " ms";
-      msg_stream << " | ";
-      msg_stream << m_hname;
-      msg_stream << " | ";
-      msg_stream << eCAL::Process::GetUnitName();
-      msg_stream << " | ";
-      msg_stream << m_pid;
-      msg_stream << " | ";
-      switch(level_)
+      cnt++;
+    }
+
+    // report dropped messages
+    const long long dropped = m_log_dropped.exchange(0);
+    if(dropped > 0)
+    {
+      SLogEntry entry;
+      entry.level   = log_level_warning;
+      entry.time    = std::chrono::duration_cast<std::chrono::microseconds>(eCAL::Time::ecal_clock::now().time_since_epoch()).count();
+      entry.content = "CLog: logging queue overflow, " + std::to_string(dropped) + " message(s) dropped";
+      WriteEntry(entry);
+    }
+  }
+
+  void CLog::WriteEntry(const SLogEntry& entry_)
+  {
+    if(entry_.level & m_filter_mask_con)
+    {
+      m_con_batch += entry_.content;
+      m_con_batch += '\n';
+    }
+
+    if((entry_.level & m_filter_mask_file) && m_logfile)
+    {
+      m_file_batch += std::to_string(entry_.time / 1000);
+      m_file_batch += " ms | ";
+      m_file_batch += m_hname;
+      m_file_batch += " | ";
+      m_file_batch += eCAL::Process::GetUnitName();
+      m_file_batch += " | ";
+      m_file_batch += std::to_string(m_pid);
+      m_file_batch += " | ";
+      m_file_batch += level_str(entry_.level);
+      m_file_batch += " | ";
+      m_file_batch += entry_.content;
+      m_file_batch += '\n';
+    }
+
+    if((entry_.level & m_filter_mask_udp) && m_udp_sender)
+    {
+      const std::string uname = eCAL::Process::GetUnitName();
+
+      // estimated serialized size of the message
+      const size_t entry_size = entry_.content.size() + m_hname.size() + m_pname.size() + uname.size() + 48;
+      if((m_udp_batch_size + entry_size > MON_LOG_UDP_BATCH_SIZE) && (m_udp_batch.logs_size() > 0))
       {
-      case log_level_none:
-      case log_level_all:
-        break;
-      case log_level_info:
-        msg_stream << "info";
-        break;
-      case log_level_warning:
-        msg_stream << "warning";
-        break;
-      case log_level_error:
-        msg_stream << "error";
-        break;
-      case log_level_fatal:
-        msg_stream << "fatal";
-        break;
-      case log_level_debug1:
-        msg_stream << "debug1";
-        break;
-      case log_level_debug2:
-        msg_stream << "debug2";
-        break;
-      case log_level_debug3:
-        msg_stream << "debug3";
-        break;
-      case log_level_debug4:
-        msg_stream << "debug4";
-        break;
+        SendUdpBatch();
       }
-      msg_stream << " | ";
-      msg_stream << msg_;
 
-      fprintf(m_logfile, "%s\n", msg_stream.str().c_str());
-      fflush(m_logfile);
+      eCAL::pb::LogMessage* ecal_msg = m_udp_batch.add_logs();
+      ecal_msg->set_time(entry_.time);
+      ecal_msg->set_hname(m_hname);
+      ecal_msg->set_pid(m_pid);
+      ecal_msg->set_pname(m_pname);
+      ecal_msg->set_uname(uname);
+      ecal_msg->set_level(entry_.level);
+      ecal_msg->set_content(entry_.content);
+      m_udp_batch_size += entry_size;
+    }
+  }
+
+  void CLog::FlushBatch()
+  {
+    if(!m_con_batch.empty())
+    {
+      std::cout << m_con_batch << std::flush;
+      m_con_batch.clear();
+    }
+
+    if(!m_file_batch.empty())
+    {
+      if(m_logfile)
+      {
+        fwrite(m_file_batch.data(), 1, m_file_batch.size(), m_logfile);
+        fflush(m_logfile);
+      }
+      m_file_batch.clear();
     }
 
-    if(log_udp && m_udp_sender)
+    SendUdpBatch();
+  }
+
+  void CLog::SendUdpBatch()
+  {
+    if(m_udp_batch.logs_size() == 0) return;
+
+    if(m_udp_batch_enabled)
+    {
+      // multiple log messages are sent as one eCAL::pb::Logging datagram
+      if(m_udp_batch.SerializeToString(&m_udp_batch_s))
+      {
+        m_udp_sender->Send((void*)m_udp_batch_s.data(), m_udp_batch_s.size());
+      }
+    }
+    else
     {
-      ecal_msg.Clear();
-      ecal_msg.set_time(std::chrono::duration_cast<std::chrono::microseconds>(log_time.time_since_epoch()).count());
-      ecal_msg.set_hname(m_hname);
-      ecal_msg.set_pid(m_pid);
-      ecal_msg.set_pname(m_pname);
-      ecal_msg.set_uname(eCAL::Process::GetUnitName());
-      ecal_msg.set_level(level_);
-      ecal_msg.set_content(msg_);
-
-      ecal_msg_s = ecal_msg.SerializeAsString();
-      if(!ecal_msg_s.empty())
+      // one eCAL::pb::LogMessage datagram per message (compatible with all receivers)
+      for(const auto& log_msg : m_udp_batch.logs())
       {
-        m_udp_sender->Send((void*)ecal_msg_s.data(), ecal_msg_s.size());
+        if(log_msg.SerializeToString(&m_udp_batch_s))
+        {
+          m_udp_sender->Send((void*)m_udp_batch_s.data(), m_udp_batch_s.size());
+        }
       }
     }
+    m_udp_batch.Clear();
+    m_udp_batch_size = 0;
   }
 
   void CLog::Log(const std::string& msg_)
@@ -30,11 +30,24 @@
 
 #include <ecal/ecal_log_level.h>
 
+#ifdef _MSC_VER
+#pragma warning(push)
+#pragma warning(disable: 4146 4800)
+#endif
+#include "ecal/pb/monitoring.pb.h"
+#ifdef _MSC_VER
+#pragma warning(pop)
+#endif
+
 #include "ecal_global_accessors.h"
+#include "ecal_bounded_queue.h"
+#include "ecal_thread.h"
 
+#include <atomic>
 #include <mutex>
 #include <memory>
 #include <chrono>
+#include <string>
 
 namespace eCAL
 {
@@ -115,16 +128,44 @@ namespace eCAL
     std::chrono::duration<double> GetCoreTime();
 
   private:
+    struct SLogEntry
+    {
+      SLogEntry() : level(log_level_none), time(0) {};
+      eCAL_Logging_eLogLevel level;
+      long long              time;
+      std::string            content;
+    };
+
     char ParseLogLevel(const std::string& filter_);
 
+    int  DrainQueue();
+    void DrainEntries();
+    void WriteEntry(const SLogEntry& entry_);
+    void FlushBatch();
+    void SendUdpBatch();
+
     CLog(const CLog&);                 // prevent copy-construction
     CLog& operator=(const CLog&);      // prevent assignment
 
     std::mutex                   m_log_sync;
 
-    bool                         m_created;
+    std::atomic<bool>            m_created;
     std::unique_ptr<CUDPSender>  m_udp_sender;
 
+    // log entries are queued by the calling threads and written by the drain thread
+    Util::CBoundedQueue<SLogEntry> m_log_queue;
+    std::atomic<long long>       m_log_dropped;
+    CThread                      m_drain_thread;
+    std::mutex                   m_drain_sync;
+
+    // drain thread batch buffers
+    std::string                  m_con_batch;
+    std::string                  m_file_batch;
+    bool                         m_udp_batch_enabled;
+    eCAL::pb::Logging            m_udp_batch;
+    size_t                       m_udp_batch_size;
+    std::string                  m_udp_batch_s;
+
     std::string                  m_hname;
     int                          m_pid;
     std::string                  m_pname;
@@ -132,10 +173,10 @@ namespace eCAL
     std::string                  m_logfile_name;
     FILE*                        m_logfile;
 
-    eCAL_Logging_eLogLevel       m_level;
-    char                         m_filter_mask_con;
-    char                         m_filter_mask_file;
-    char                         m_filter_mask_udp;
+    std::atomic<eCAL_Logging_eLogLevel> m_level;
+    std::atomic<char>            m_filter_mask_con;
+    std::atomic<char>            m_filter_mask_file;
+    std::atomic<char>            m_filter_mask_udp;
 
     std::chrono::duration<double> m_core_time;
 
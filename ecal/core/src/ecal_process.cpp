@@ -593,15 +593,6 @@ namespace
     }
   }
 
-  int parseLine(char* line)
-  {
-    int i = strlen(line);
-    while (*line < '0' || *line > '9') line++;
-    line[i - 3] = '\0';
-    i = atoi(line);
-    return i;
-  }
-
   /**
    * @brief Checks whether all requirements for using a terminal emulator are fulfilled and then returns the according command
    * @return The terminal emulator command or an empty string, if the requirements are not fulfilled
@@ -771,21 +762,9 @@ namespace eCAL
 
     unsigned long GetProcessMemory()
     {
-      FILE* file = fopen("/proc/self/status", "r");
-      if (file == nullptr) return(0);
-
-      int result = 0;
-      char line[128] = { 0 };
-      while (fgets(line, 128, file) != nullptr)
-      {
-        if (strncmp(line, "VmSize:", 7) == 0)
-        {
-          result = parseLine(line);
-          break;
-        }
-      }
-      fclose(file);
-      return(result * 1024);
+      SProcessUsage usage;
+      if (!GetProcessUsage(usage)) return(0);
+      return(static_cast<unsigned long>(usage.memory_virtual));
     }
 
     int StartProcess(const char* proc_name_,
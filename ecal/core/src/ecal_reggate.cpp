@@ -87,7 +87,7 @@ namespace eCAL
     attr.rcvbuf     = eCALPAR(NET, UDP_MULTICAST_RCVBUF);
     attr.local_only = !m_network;
     m_reg_rcv.Create(attr);
-    m_reg_rcv_thread.Start(0, std::bind(&CUdpRegistrationReceiver::Receive, &m_reg_rcv_process, &m_reg_rcv));
+    m_reg_rcv_thread.Start(0, std::bind(&CUdpRegistrationReceiver::Receive, &m_reg_rcv_process, &m_reg_rcv), Thread::thread_class_registration, "ecal_reg_rcv");
 
     m_created = true;
   }
@@ -30,11 +30,13 @@
 #include "ecal_timegate.h"
 #include "pubsub/ecal_pubgate.h"
 #include "pubsub/ecal_subgate.h"
+#include "sys_usage.h"
 
 #include <sstream>
 #include <iostream>
 #include <chrono>
 #include <thread>
+#include <vector>
 
 #ifdef _MSC_VER
 #pragma warning(push)
@@ -91,7 +93,8 @@ namespace eCAL
     attr.sndbuf     = eCALPAR(NET, UDP_MULTICAST_SNDBUF);
     attr.local_only = !eCALPAR(NET, ENABLED);
     m_reg_snd.Create(attr);
-    m_reg_snd_thread.Start(eCALPAR(CMN, REGISTRATION_REFRESH), std::bind(&CEntityRegister::RegisterSendThread, this));
+    m_reg_snd_thread.Start(eCALPAR(CMN, REGISTRATION_REFRESH), std::bind(&CEntityRegister::RegisterSendThread, this), Thread::thread_class_registration, "ecal_reg_snd");
+    m_reg_force_thread.Start(eCALPAR(CMN, REGISTRATION_REFRESH), std::bind(&CEntityRegister::ForcedRegisterSendThread, this), Thread::thread_class_registration, "ecal_reg_force");
 
     m_created = true;
   }
@@ -100,6 +103,7 @@ namespace eCAL
   {
     if(!m_created) return;
 
+    m_reg_force_thread.Stop();
     m_reg_snd_thread.Stop();
 
     m_created = false;
@@ -110,15 +114,15 @@ namespace eCAL
     if(!m_created)    return(false);
     if(!m_reg_topics) return (false);
 
-    std::lock_guard<std::mutex> lock(m_topics_map_sync);
-    m_topics_map[topic_name_ + topic_id_] = ecal_sample_;
-    if(force_)
     {
-      RegisterProcess();
-      RegisterSample(topic_name_, ecal_sample_);
-      std::this_thread::sleep_for(std::chrono::milliseconds(1));
+      std::lock_guard<std::mutex> lock(m_topics_map_sync);
+      m_topics_map[topic_name_ + topic_id_] = ecal_sample_;
+      if(force_) m_topics_forced.insert(topic_name_ + topic_id_);
     }
 
+    // trigger forced registration
+    if(force_) m_reg_force_thread.Fire();
+
     return(true);
   }
 
@@ -143,15 +147,15 @@ namespace eCAL
     if(!m_created)      return(false);
     if(!m_reg_services) return(false);
 
-    std::lock_guard<std::mutex> lock(m_service_map_sync);
-    m_service_map[service_name_] = ecal_sample_;
-    if(force_)
     {
-      RegisterProcess();
-      RegisterSample(service_name_, ecal_sample_);
-      std::this_thread::sleep_for(std::chrono::milliseconds(1));
+      std::lock_guard<std::mutex> lock(m_service_map_sync);
+      m_service_map[service_name_] = ecal_sample_;
+      if(force_) m_service_forced.insert(service_name_);
     }
 
+    // trigger forced registration
+    if(force_) m_reg_force_thread.Fire();
+
     return(true);
   }
 
@@ -184,7 +188,13 @@ namespace eCAL
     process_sample_mutable_process->set_pname(Process::GetProcessName());
     process_sample_mutable_process->set_uname(Process::GetUnitName());
     process_sample_mutable_process->set_pparam(Process::GetProcessParameter());
-    process_sample_mutable_process->set_pmemory(Process::GetProcessMemory());
+    SProcessUsage process_usage;
+    GetProcessUsage(process_usage);
+    process_sample_mutable_process->set_pmemory(google::protobuf::int64(process_usage.memory_virtual));
+    process_sample_mutable_process->set_prss(google::protobuf::int64(process_usage.memory_resident));
+    process_sample_mutable_process->set_pthreads(process_usage.threads);
+    process_sample_mutable_process->set_pvcsw(process_usage.ctx_switches_voluntary);
+    process_sample_mutable_process->set_pivcsw(process_usage.ctx_switches_involuntary);
     process_sample_mutable_process->set_pcpu(Process::GetProcessCpuUsage());
     process_sample_mutable_process->set_usrptime(static_cast<float>(Logging::GetCoreTime()));
     process_sample_mutable_process->set_udpsbytes(google::protobuf::int32(Process::GetSBytes()));
@@ -319,4 +329,56 @@ namespace eCAL
 
     return(0);
   };
+
+  int CEntityRegister::ForcedRegisterSendThread()
+  {
+    if(!m_created) return(0);
+
+    // rate limit forced registration bursts, all forced
+    // registrations requested in between are coalesced
+    auto next_time = m_reg_force_last + std::chrono::milliseconds(CMN_REGISTRATION_FORCE_MIN_DELAY);
+    if(std::chrono::steady_clock::now() < next_time) std::this_thread::sleep_until(next_time);
+
+    // collect queued topic and service samples
+    std::vector<eCAL::pb::Sample> topic_samples;
+    {
+      std::lock_guard<std::mutex> lock(m_topics_map_sync);
+      for(const auto& key : m_topics_forced)
+      {
+        auto iter = m_topics_map.find(key);
+        if(iter != m_topics_map.end()) topic_samples.push_back(iter->second);
+      }
+      m_topics_forced.clear();
+    }
+    std::vector<eCAL::pb::Sample> service_samples;
+    {
+      std::lock_guard<std::mutex> lock(m_service_map_sync);
+      for(const auto& key : m_service_forced)
+      {
+        auto iter = m_service_map.find(key);
+        if(iter != m_service_map.end()) service_samples.push_back(iter->second);
+      }
+      m_service_forced.clear();
+    }
+    if(topic_samples.empty() && service_samples.empty()) return(0);
+
+    // register process once per burst
+    RegisterProcess();
+
+    // register services
+    for(const auto& sample : service_samples)
+    {
+      RegisterSample(sample.service().sname(), sample);
+    }
+
+    // register topics
+    for(const auto& sample : topic_samples)
+    {
+      RegisterSample(sample.topic().tname(), sample);
+    }
+
+    m_reg_force_last = std::chrono::steady_clock::now();
+
+    return(0);
+  }
 };
@@ -30,7 +30,9 @@
 #include "io/udp_sender.h"
 #include "io/snd_sample.h"
 
+#include <chrono>
 #include <mutex>
+#include <set>
 #include <string>
 #include <unordered_map>
 #include <atomic>
@@ -69,6 +71,7 @@ namespace eCAL
     size_t RegisterSample(const std::string& sample_name_, const eCAL::pb::Sample& sample_);
 
     int RegisterSendThread();
+    int ForcedRegisterSendThread();
 
     static std::atomic<bool>  m_created;
     std::string               m_multicast_group;
@@ -80,12 +83,20 @@ namespace eCAL
     CUDPSender                m_reg_snd;
     CThread                   m_reg_snd_thread;
 
+    // forced registrations are queued (coalesced per entity)
+    // and sent by the forced registration thread
+    CThread                   m_reg_force_thread;
+    std::chrono::steady_clock::time_point m_reg_force_last;
+
     typedef std::unordered_map<std::string, eCAL::pb::Sample> SampleMapT;
+    typedef std::set<std::string> SampleKeySetT;
     std::mutex                m_topics_map_sync;
     SampleMapT                m_topics_map;
+    SampleKeySetT             m_topics_forced;
 
     std::mutex                m_service_map_sync;
     SampleMapT                m_service_map;
+    SampleKeySetT             m_service_forced;
 
     //eCAL::pb::Sample            m_process_sample;
   };
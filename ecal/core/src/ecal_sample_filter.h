@@ -0,0 +1,179 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright (C) 2016 - 2019 Continental Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+
+/**
+ * @brief  eCAL sample hash filter
+**/
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace eCAL
+{
+  namespace Util
+  {
+    /**
+    * @brief A filter remembering the sample hashes of a time window.
+    *
+    * Four way set associative table indexed by the hash, a new hash replaces the
+    * oldest (or an expired) entry of its set. Hashes stay known for the window.
+    * The table doubles (up to max_capacity_) when more hashes are inserted per
+    * window than an eighth of its entries, so it follows the sample rate and
+    * only allocates while growing. A hash evicted by a colliding one is
+    * forgotten, so a late duplicate may pass, but a sample is never dropped
+    * unless its exact hash was inserted within the window.
+    **/
+    class CSampleHashFilter
+    {
+    public:
+      explicit CSampleHashFilter(long long window_us_ = 500000, size_t capacity_ = 1024, size_t max_capacity_ = 262144) :
+        m_window(window_us_),
+        m_max_sets(RoundUpPow2(max_capacity_ / ways)),
+        m_mask(RoundUpPow2(capacity_ / ways) - 1),
+        m_sets(m_mask + 1),
+        m_window_start(0),
+        m_window_count(0),
+        m_last_window_count(0)
+      {
+      };
+
+      /**
+      * @brief  insert the hash
+      *
+      * @param hash_  The sample hash.
+      * @param time_  Monotonic receive time in us.
+      *
+      * @return  false if the hash is already known (duplicate)
+      **/
+      bool insert(size_t hash_, long long time_)
+      {
+        SSet& set = m_sets[Index(hash_)];
+        for (const auto& entry : set.entry)
+        {
+          if (Valid(entry, time_) && (entry.hash == hash_)) return false;
+        }
+
+        // count the hashes inserted per window
+        if (time_ - m_window_start >= m_window)
+        {
+          m_last_window_count = m_window_count;
+          m_window_count      = 0;
+          m_window_start      = time_;
+        }
+        m_window_count++;
+
+        // grow the table if it is too small for the sample rate
+        const size_t count = (m_window_count > m_last_window_count) ? m_window_count : m_last_window_count;
+        if ((2 * count > m_sets.size()) && (m_sets.size() < m_max_sets)) Grow(time_);
+
+        SEntry& victim = Victim(m_sets[Index(hash_)]);
+        victim.hash = hash_;
+        victim.time = time_;
+        return true;
+      };
+
+      void clear()
+      {
+        for (auto& set : m_sets) set = SSet();
+        m_window_start      = 0;
+        m_window_count      = 0;
+        m_last_window_count = 0;
+      };
+
+    private:
+      static const size_t ways = 4;
+
+      struct SEntry
+      {
+        SEntry() : hash(0), time(0) {};
+        size_t     hash;
+        long long  time;  // insertion time in us, 0 == empty
+      };
+      struct SSet
+      {
+        SEntry entry[ways];
+      };
+
+      bool Valid(const SEntry& entry_, long long time_) const
+      {
+        return((entry_.time != 0) && (time_ - entry_.time < m_window));
+      }
+
+      static SEntry& Victim(SSet& set_)
+      {
+        SEntry* victim = &set_.entry[0];
+        for (auto& entry : set_.entry)
+        {
+          if (entry.time < victim->time) victim = &entry;
+        }
+        return(*victim);
+      }
+
+      void Grow(long long time_)
+      {
+        std::vector<SSet> sets;
+        sets.swap(m_sets);
+        m_mask = 2 * (m_mask + 1) - 1;
+        m_sets.resize(m_mask + 1);
+
+        // move over the hashes that are still inside the window
+        for (const auto& set : sets)
+        {
+          for (const auto& entry : set.entry)
+          {
+            if (!Valid(entry, time_)) continue;
+            SEntry& victim = Victim(m_sets[Index(entry.hash)]);
+            if (victim.time < entry.time) victim = entry;
+          }
+        }
+      }
+
+      size_t Index(size_t hash_) const
+      {
+        // mix the bits, the sample hashes are built from sequential clocks
+        // and std::hash implementations may be weak in the low bits
+        uint64_t mix = static_cast<uint64_t>(hash_);
+        mix ^= mix >> 33;
+        mix *= 0xff51afd7ed558ccdULL;
+        mix ^= mix >> 33;
+        return(static_cast<size_t>(mix) & m_mask);
+      }
+
+      static size_t RoundUpPow2(size_t value_)
+      {
+        size_t pow2(1);
+        while (pow2 < value_) pow2 <<= 1;
+        return(pow2);
+      }
+
+      long long          m_window;
+      size_t             m_max_sets;
+      size_t             m_mask;
+      std::vector<SSet>  m_sets;
+
+      long long          m_window_start;
+      size_t             m_window_count;
+      size_t             m_last_window_count;
+    };
+  }
+}
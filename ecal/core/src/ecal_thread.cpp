@@ -22,12 +22,170 @@
 **/
 
 #include <ecal/ecal_event.h>
+#include <ecal/ecal_log.h>
 
+#include "ecal_def.h"
+#include "ecal_config_hlp.h"
+#include "ecal_global_accessors.h"
 #include "ecal_thread.h"
+
+#include <cctype>
+#include <cstdlib>
+#include <mutex>
+#include <sstream>
 #include <thread>
 
+#ifdef ECAL_OS_LINUX
+#include <pthread.h>
+#include <sched.h>
+#endif /* ECAL_OS_LINUX */
+
+namespace
+{
+  // ecal.ini key prefix of the thread classes
+  const char* thread_class_key[eCAL::Thread::thread_class_count] =
+  {
+    "registration",
+    "timeout",
+    "monitoring",
+    "logging",
+    "udp_receive",
+    "shm_receive",
+    "service",
+    "publisher",
+    "callback"
+  };
+
+  // thread attributes set by api
+  struct SThreadAttrTable
+  {
+    SThreadAttrTable() : is_set() {};
+    std::mutex                 sync;
+    eCAL::Thread::SThreadAttr  attr[eCAL::Thread::thread_class_count];
+    bool                       is_set[eCAL::Thread::thread_class_count];
+  };
+
+  SThreadAttrTable& thread_attr_table()
+  {
+    static SThreadAttrTable table;
+    return(table);
+  }
+
+  // remove quotes and white spaces of an ini value
+  std::string strip_value(const std::string& value_)
+  {
+    std::string value;
+    for (auto c : value_)
+    {
+      if ((c != '"') && !isspace(static_cast<unsigned char>(c))) value += c;
+    }
+    return(value);
+  }
+
+  eCAL::Thread::eSchedPolicy parse_policy(const std::string& policy_)
+  {
+    const std::string policy = strip_value(policy_);
+    if (policy == "fifo") return(eCAL::Thread::sched_policy_fifo);
+    if (policy == "rr")   return(eCAL::Thread::sched_policy_rr);
+    return(eCAL::Thread::sched_policy_other);
+  }
+
+  // parse a cpu list like "0,2,4-7"
+  std::vector<int> parse_cpus(const std::string& cpus_)
+  {
+    std::vector<int> cpus;
+    std::stringstream ss(strip_value(cpus_));
+    std::string range;
+    while (std::getline(ss, range, ','))
+    {
+      if (range.find_first_of("0123456789") == std::string::npos) continue;
+      const size_t sep  = range.find('-');
+      const int    from = atoi(range.substr(0, sep).c_str());
+      const int    to   = (sep == std::string::npos) ? from : atoi(range.substr(sep + 1).c_str());
+      for (int cpu = from; cpu <= to; ++cpu) cpus.push_back(cpu);
+    }
+    return(cpus);
+  }
+
+  eCAL::Thread::SThreadAttr config_thread_attr(eCAL::Thread::eThreadClass class_)
+  {
+    eCAL::Thread::SThreadAttr attr;
+    if (eCAL::g_config() == nullptr) return(attr);
+
+    const std::string key = thread_class_key[class_];
+    attr.policy   = parse_policy(eCAL::g_config()->get(THREAD_SECTION_S, key + THREAD_POLICY_S,   THREAD_POLICY));
+    attr.priority =              eCAL::g_config()->get(THREAD_SECTION_S, key + THREAD_PRIORITY_S, THREAD_PRIORITY);
+    attr.cpus     = parse_cpus  (eCAL::g_config()->get(THREAD_SECTION_S, key + THREAD_CPUS_S,     THREAD_CPUS));
+    return(attr);
+  }
+}
+
 namespace eCAL
 {
+  namespace Thread
+  {
+    bool SetThreadAttr(eThreadClass class_, const SThreadAttr& attr_)
+    {
+      if ((class_ < 0) || (class_ >= thread_class_count)) return(false);
+
+      SThreadAttrTable& table = thread_attr_table();
+      std::lock_guard<std::mutex> lock(table.sync);
+      table.attr[class_]   = attr_;
+      table.is_set[class_] = true;
+      return(true);
+    }
+
+    SThreadAttr GetThreadAttr(eThreadClass class_)
+    {
+      if ((class_ < 0) || (class_ >= thread_class_count)) return(SThreadAttr());
+
+      {
+        SThreadAttrTable& table = thread_attr_table();
+        std::lock_guard<std::mutex> lock(table.sync);
+        if (table.is_set[class_]) return(table.attr[class_]);
+      }
+      return(config_thread_attr(class_));
+    }
+  }
+
+  void SetCurrentThreadAttr(Thread::eThreadClass class_, const std::string& name_)
+  {
+#ifdef ECAL_OS_LINUX
+    // thread names are limited to 16 bytes including the terminator
+    pthread_setname_np(pthread_self(), name_.substr(0, 15).c_str());
+
+    const Thread::SThreadAttr attr = Thread::GetThreadAttr(class_);
+
+    if (attr.policy != Thread::sched_policy_other)
+    {
+      struct sched_param param;
+      param.sched_priority = attr.priority;
+      const int policy = (attr.policy == Thread::sched_policy_fifo) ? SCHED_FIFO : SCHED_RR;
+      if (pthread_setschedparam(pthread_self(), policy, &param) != 0)
+      {
+        Logging::Log(log_level_warning, name_ + " - could not set thread scheduling policy (missing CAP_SYS_NICE ?)");
+      }
+    }
+
+    if (!attr.cpus.empty())
+    {
+      cpu_set_t cpu_set;
+      CPU_ZERO(&cpu_set);
+      for (auto cpu : attr.cpus)
+      {
+        if ((cpu >= 0) && (cpu < CPU_SETSIZE)) CPU_SET(cpu, &cpu_set);
+      }
+      if (pthread_setaffinity_np(pthread_self(), sizeof(cpu_set), &cpu_set) != 0)
+      {
+        Logging::Log(log_level_warning, name_ + " - could not set thread cpu affinity");
+      }
+    }
+#else
+    (void)class_;
+    (void)name_;
+#endif /* ECAL_OS_LINUX */
+  }
+
   CThread::CThread()
   {
   }
@@ -37,16 +195,18 @@ namespace eCAL
     try { Stop(); } catch(...) { /*??*/ }
   }
 
-  int CThread::Start(int period_, std::function<int()> ext_caller_)
+  int CThread::Start(int period_, std::function<int()> ext_caller_, Thread::eThreadClass class_, const std::string& name_)
   {
     if(m_tdata.is_started) return(0);
 
     gOpenEvent(&m_tdata.event);
-    m_tdata.do_stop     = false;
-    m_tdata.period      = period_;
-    m_tdata.ext_caller  = ext_caller_;
-    m_tdata.thread      = std::thread(CThread::HelperThread, (void*)&m_tdata);
-    m_tdata.is_started  = true;
+    m_tdata.do_stop      = false;
+    m_tdata.period       = period_;
+    m_tdata.ext_caller   = ext_caller_;
+    m_tdata.thread_class = class_;
+    m_tdata.name         = name_;
+    m_tdata.thread       = std::thread(CThread::HelperThread, (void*)&m_tdata);
+    m_tdata.is_started   = true;
 
     gSetEvent(m_tdata.event);
 
@@ -86,6 +246,9 @@ namespace eCAL
     struct ThreadData* tdata = static_cast<ThreadData*>(par_);
     if(!gEventIsValid(tdata->event)) return;
 
+    // thread name, scheduling and affinity
+    SetCurrentThreadAttr(tdata->thread_class, tdata->name);
+
     // mark as running
     tdata->is_running = true;
 
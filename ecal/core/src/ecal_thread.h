@@ -24,20 +24,31 @@
 #pragma once
 
 #include <ecal/ecal_eventhandle.h>
+#include <ecal/ecal_thread_attr.h>
 
 #include <atomic>
 #include <thread>
 #include <functional>
+#include <string>
 
 namespace eCAL
 {
+  /**
+   * @brief Name the calling thread and apply the scheduling policy,
+   *        priority and cpu affinity configured for its thread class.
+   *
+   * @param class_  The thread class.
+   * @param name_   The thread name (truncated to 15 characters on linux).
+  **/
+  void SetCurrentThreadAttr(Thread::eThreadClass class_, const std::string& name_);
+
   class CThread
   {
   public:
     CThread();
     virtual ~CThread();
 
-    int Start(int period, std::function<int()> ext_caller_);
+    int Start(int period, std::function<int()> ext_caller_, Thread::eThreadClass class_, const std::string& name_);
     int Stop();
     int Fire();
 
@@ -51,6 +62,7 @@ namespace eCAL
        , is_running(false)
        , is_started(false)
        , do_stop(false)
+       , thread_class(Thread::thread_class_registration)
       {
       };
       std::thread             thread;
@@ -60,6 +72,8 @@ namespace eCAL
       std::atomic<bool>       is_started;
       std::atomic<bool>       do_stop;
       std::function<int()>    ext_caller;
+      Thread::eThreadClass    thread_class;
+      std::string             name;
     };
     struct ThreadData m_tdata;
 
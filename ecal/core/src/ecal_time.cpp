@@ -40,22 +40,24 @@ namespace eCAL
 
     long long GetMicroSeconds()
     {
-      if (!g_timegate() || !g_timegate()->IsValid())
+      long long time_ns(0);
+      if (!g_timegate() || !g_timegate()->GetCachedNanoSeconds(time_ns))
       {
         std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
         return(std::chrono::duration_cast<std::chrono::microseconds>(now.time_since_epoch()).count());
       }
-      return(g_timegate()->GetMicroSeconds());
+      return(time_ns / 1000);
     }
 
     long long GetNanoSeconds()
     {
-      if (!g_timegate() || !g_timegate()->IsValid())
+      long long time_ns(0);
+      if (!g_timegate() || !g_timegate()->GetCachedNanoSeconds(time_ns))
       {
         std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
         return(std::chrono::duration_cast<std::chrono::nanoseconds>(now.time_since_epoch()).count());
       }
-      return(g_timegate()->GetNanoSeconds());
+      return(time_ns);
     }
 
     bool SetNanoSeconds(long long time_)
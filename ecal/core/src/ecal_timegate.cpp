@@ -31,6 +31,7 @@
 
 #include <iostream>
 #include <chrono>
+#include <limits>
 #include <thread>
 
 #define etime_initialize_name            "etime_initialize"
@@ -60,7 +61,17 @@ namespace eCAL
     m_is_initialized_replay(false),
     m_successfully_loaded_rt(false),
     m_successfully_loaded_replay(false),
-    m_sync_mode(eTimeSyncMode::none)
+    m_sync_mode(eTimeSyncMode::none),
+    m_clock_cache_refresh_ns(0),
+    m_clock_cache_seq(0),
+    m_clock_cache_generation(0),
+    m_clock_cache_offset_ns(0),
+    m_clock_cache_expire_ns(0),
+    m_clock_cache_mode(eTimeSyncMode::none),
+    m_clock_cache_valid(false),
+    m_clock_cache_refreshing(false),
+    m_clock_cache_synchronized(false),
+    m_clock_cache_last_ns(std::numeric_limits<long long>::min())
   {
   };
 
@@ -105,6 +116,15 @@ namespace eCAL
       m_is_initialized_replay = m_time_sync_replay.etime_initialize_ptr() == 0;
     }
 
+    // replay time may jump or pause at any moment, so only the realtime
+    // module time is extrapolated from the monotonic clock
+    m_clock_cache_refresh_ns = 0;
+    if (m_sync_mode == eTimeSyncMode::realtime)
+    {
+      m_clock_cache_refresh_ns = static_cast<long long>(eCALPAR(TIME, FASTCLOCK_REFRESH)) * 1000 * 1000;
+    }
+    InvalidateClockCache();
+
     m_created = true;
   }
 
@@ -128,6 +148,7 @@ namespace eCAL
     }
     m_is_initialized_rt     = false;
     m_is_initialized_replay = false;
+    InvalidateClockCache();
 
     m_created = false;
   }
@@ -169,27 +190,146 @@ namespace eCAL
     return(master_ns);
   }
 
+  bool CTimeGate::GetCachedNanoSeconds(long long& time_ns_)
+  {
+    if (!m_created) return(false);
+
+    // replay time may jump or pause, ask the module every time
+    if (m_clock_cache_refresh_ns <= 0)
+    {
+      if (!IsValid()) return(false);
+      time_ns_ = GetNanoSeconds();
+      return(true);
+    }
+
+    const long long steady_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+    SClockCache cache;
+    ReadClockCache(cache);
+    if (!cache.valid || (cache.mode != m_sync_mode) || (steady_ns >= cache.expire_ns))
+    {
+      // single flight, one caller refreshes and the others
+      // keep using the previous offset in the meantime
+      bool refreshing(false);
+      if (m_clock_cache_refreshing.compare_exchange_strong(refreshing, true))
+      {
+        RefreshClockCache(steady_ns);
+        m_clock_cache_refreshing = false;
+        ReadClockCache(cache);
+      }
+
+      // no usable offset (yet), ask the module
+      if (!cache.valid || (cache.mode != m_sync_mode))
+      {
+        if (!IsValid()) return(false);
+        cache.offset_ns = GetNanoSeconds() - steady_ns;
+      }
+    }
+
+    // a refreshed offset may be a bit lower than the previous one,
+    // never return a time below the last returned one
+    long long time_ns = steady_ns + cache.offset_ns;
+    long long last_ns = m_clock_cache_last_ns.load(std::memory_order_relaxed);
+    while ((time_ns > last_ns) && !m_clock_cache_last_ns.compare_exchange_weak(last_ns, time_ns, std::memory_order_relaxed)) {}
+    if (time_ns < last_ns) time_ns = last_ns;
+
+    time_ns_ = time_ns;
+    return(true);
+  }
+
+  void CTimeGate::ReadClockCache(SClockCache& cache_)
+  {
+    unsigned int seq(0);
+    do
+    {
+      // odd sequence, a writer is publishing
+      while ((seq = m_clock_cache_seq.load(std::memory_order_acquire)) & 1) {}
+      cache_.offset_ns = m_clock_cache_offset_ns.load(std::memory_order_relaxed);
+      cache_.expire_ns = m_clock_cache_expire_ns.load(std::memory_order_relaxed);
+      cache_.mode      = static_cast<eTimeSyncMode>(m_clock_cache_mode.load(std::memory_order_relaxed));
+      cache_.valid     = m_clock_cache_valid.load(std::memory_order_relaxed);
+      std::atomic_thread_fence(std::memory_order_acquire);
+    } while (seq != m_clock_cache_seq.load(std::memory_order_relaxed));
+  }
+
+  void CTimeGate::WriteClockCache(const SClockCache& cache_, unsigned int generation_)
+  {
+    // make the sequence odd, this serializes the writers
+    unsigned int seq = m_clock_cache_seq.load(std::memory_order_relaxed);
+    do
+    {
+      seq &= ~1u;
+    } while (!m_clock_cache_seq.compare_exchange_weak(seq, seq + 1, std::memory_order_relaxed));
+    std::atomic_thread_fence(std::memory_order_release);
+
+    if (generation_ == m_clock_cache_generation)
+    {
+      m_clock_cache_offset_ns.store(cache_.offset_ns, std::memory_order_relaxed);
+      m_clock_cache_expire_ns.store(cache_.expire_ns, std::memory_order_relaxed);
+      m_clock_cache_mode.store(cache_.mode, std::memory_order_relaxed);
+      m_clock_cache_valid.store(cache_.valid, std::memory_order_relaxed);
+    }
+
+    m_clock_cache_seq.store(seq + 2, std::memory_order_release);
+  }
+
+  void CTimeGate::RefreshClockCache(long long steady_ns_)
+  {
+    const unsigned int generation = m_clock_cache_generation;
+
+    SClockCache cache;
+    cache.mode  = m_sync_mode;
+    cache.valid = IsValid();
+    if (cache.valid)
+    {
+      // a changed sync state makes the module time jump, so check it
+      // again on the next call instead of waiting a full period
+      // and allow the returned time to jump back
+      const bool synchronized = IsSynchronized();
+      const bool sync_changed = (synchronized != m_clock_cache_synchronized.exchange(synchronized));
+      if (sync_changed) m_clock_cache_last_ns = std::numeric_limits<long long>::min();
+
+      // take the module time between two monotonic samples
+      // and assume it was taken in the middle of them
+      const long long module_ns = GetNanoSeconds();
+      const long long steady_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+      cache.offset_ns = module_ns - (steady_ns_ + (steady_ns - steady_ns_) / 2);
+      cache.expire_ns = sync_changed ? 0 : steady_ns + m_clock_cache_refresh_ns;
+    }
+    WriteClockCache(cache, generation);
+  }
+
+  void CTimeGate::InvalidateClockCache()
+  {
+    const unsigned int generation = ++m_clock_cache_generation;
+    WriteClockCache(SClockCache(), generation);
+    m_clock_cache_last_ns = std::numeric_limits<long long>::min();
+  }
+
   bool CTimeGate::SetNanoSeconds(long long time_)
   {
     if (!m_created) return(false);
 
+    bool ret(false);
     switch (m_sync_mode)
     {
     case eTimeSyncMode::none:
       return(false);
     case eTimeSyncMode::realtime:
       if (m_is_initialized_rt)
-        return(m_time_sync_rt.etime_set_nanoseconds_ptr(time_) == 0);
+        ret = m_time_sync_rt.etime_set_nanoseconds_ptr(time_) == 0;
       break;
     case eTimeSyncMode::replay:
       if (m_is_initialized_replay)
-        return(m_time_sync_replay.etime_set_nanoseconds_ptr(time_) == 0);
+        ret = m_time_sync_replay.etime_set_nanoseconds_ptr(time_) == 0;
       break;
     default:
       return(false);
     }
 
-    return(false);
+    // the module time jumped, drop the cached offset
+    InvalidateClockCache();
+
+    return(ret);
   }
 
   bool CTimeGate::IsSynchronized()
@@ -74,6 +74,21 @@ namespace eCAL
     long long GetMicroSeconds();
     long long GetNanoSeconds();
 
+    /**
+     * @brief Get the module time from the cached offset to the monotonic clock.
+     *
+     * The module is only called again when the cache expired (time/fastclock_refresh)
+     * or the sync state changed, one caller refreshes while the others keep using the
+     * previous offset. The returned realtime time never goes backwards, unless it is
+     * set explicitly or the sync state changes. In replay mode the module is called
+     * every time.
+     *
+     * @param time_ns_  Current module time in ns.
+     *
+     * @return  False if the time gate is not valid (not created or module error).
+    **/
+    bool GetCachedNanoSeconds(long long& time_ns_);
+
     bool SetNanoSeconds(long long time_);
 
     bool IsSynchronized();
@@ -130,6 +145,35 @@ namespace eCAL
     };
     bool LoadModule(const std::string& interface_name_, STimeDllInterface& interface_);
 
+    struct SClockCache
+    {
+      SClockCache() : offset_ns(0), expire_ns(0), mode(eTimeSyncMode::none), valid(false) {};
+      long long      offset_ns;   // module time - monotonic time
+      long long      expire_ns;   // monotonic time of the next refresh
+      eTimeSyncMode  mode;        // sync mode the offset was taken in
+      bool           valid;
+    };
+    void ReadClockCache(SClockCache& cache_);
+    void WriteClockCache(const SClockCache& cache_, unsigned int generation_);
+    void RefreshClockCache(long long steady_ns_);
+    void InvalidateClockCache();
+
+    long long                  m_clock_cache_refresh_ns;
+
+    // offset, expiry, mode and state are published together (seqlock),
+    // an invalidation bumps the generation so a refresh started before
+    // it does not publish its outdated offset
+    std::atomic<unsigned int>  m_clock_cache_seq;
+    std::atomic<unsigned int>  m_clock_cache_generation;
+    std::atomic<long long>     m_clock_cache_offset_ns;
+    std::atomic<long long>     m_clock_cache_expire_ns;
+    std::atomic<int>           m_clock_cache_mode;
+    std::atomic<bool>          m_clock_cache_valid;
+
+    std::atomic<bool>          m_clock_cache_refreshing;
+    std::atomic<bool>          m_clock_cache_synchronized;
+    std::atomic<long long>     m_clock_cache_last_ns;
+
     STimeDllInterface        m_time_sync_rt;
     STimeDllInterface        m_time_sync_replay;
   };
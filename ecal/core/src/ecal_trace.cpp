@@ -0,0 +1,170 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright (C) 2016 - 2019 Continental Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+/**
+ * @brief  eCAL hot path trace points
+**/
+
+#include <ecal/ecal.h>
+
+#include "ecal_def.h"
+#include "ecal_trace.h"
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <stdio.h>
+#include <string>
+#include <vector>
+
+namespace
+{
+  const char* g_probe_name[eCAL::Trace::probe_count] =
+  {
+    "writer_send",
+    "writer_send_inproc",
+    "writer_send_shm",
+    "writer_send_udp_mc",
+    "writer_send_udp_uc",
+    "writer_send_lcm",
+    "writer_send_rtps",
+    "memfile_lock",
+    "memfile_unlock",
+    "event_set",
+    "event_wait",
+    "udp_fragment_out",
+    "udp_fragment_in",
+    "subgate_dispatch",
+    "reader_callback"
+  };
+
+  struct STraceEvent
+  {
+    long long          time;   // steady clock [ns]
+    long long          arg;
+    unsigned short     probe;
+    char               phase;
+  };
+
+  struct STraceBuffer
+  {
+    explicit STraceBuffer(int tid_) : tid(tid_), pos(0), events(CMN_TRACE_BUFFER_SIZE) {};
+    int                      tid;
+    std::atomic<size_t>      pos;
+    std::vector<STraceEvent> events;
+  };
+
+  // all thread buffers, kept alive until process exit
+  // so that events of terminated threads can be exported too
+  struct STraceRegistry
+  {
+    std::mutex                                 sync;
+    std::vector<std::unique_ptr<STraceBuffer>> buffers;
+  };
+
+  STraceRegistry& GetRegistry()
+  {
+    static STraceRegistry registry;
+    return(registry);
+  }
+
+  STraceBuffer* GetThreadBuffer()
+  {
+    static thread_local STraceBuffer* buffer(nullptr);
+    if (buffer == nullptr)
+    {
+      STraceRegistry& registry = GetRegistry();
+      std::lock_guard<std::mutex> lock(registry.sync);
+      registry.buffers.emplace_back(new STraceBuffer(static_cast<int>(registry.buffers.size()) + 1));
+      buffer = registry.buffers.back().get();
+    }
+    return(buffer);
+  }
+}
+
+namespace eCAL
+{
+  namespace Trace
+  {
+    void Record(eProbe probe_, ePhase phase_, long long arg_)
+    {
+      STraceBuffer* buffer = GetThreadBuffer();
+
+      // single writer per buffer, the exporter reads the published range only
+      const size_t pos = buffer->pos.load(std::memory_order_relaxed);
+      STraceEvent& event = buffer->events[pos % buffer->events.size()];
+      event.time  = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+      event.arg   = arg_;
+      event.probe = static_cast<unsigned short>(probe_);
+      event.phase = static_cast<char>(phase_);
+      buffer->pos.store(pos + 1, std::memory_order_release);
+    }
+
+    bool Export(const std::string& file_name_)
+    {
+      FILE* file = fopen(file_name_.c_str(), "w");
+      if (file == nullptr) return(false);
+
+      const int pid = Process::GetProcessID();
+      bool first(true);
+      fprintf(file, "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[");
+
+      STraceRegistry& registry = GetRegistry();
+      std::lock_guard<std::mutex> lock(registry.sync);
+      for (const auto& buffer : registry.buffers)
+      {
+        // events that are overwritten while exporting may be inconsistent
+        const size_t size  = buffer->events.size();
+        const size_t pos   = buffer->pos.load(std::memory_order_acquire);
+        const size_t count = pos < size ? pos : size;
+        for (size_t i = pos - count; i < pos; ++i)
+        {
+          const STraceEvent& event = buffer->events[i % size];
+          if (event.probe >= probe_count) continue;
+
+          fprintf(file, "%s\n{\"name\":\"%s\",\"cat\":\"ecal\",\"ph\":\"%c\",\"ts\":%lld.%03lld,\"pid\":%d,\"tid\":%d",
+            first ? "" : ",",
+            g_probe_name[event.probe],
+            event.phase,
+            event.time / 1000, event.time % 1000,
+            pid,
+            buffer->tid);
+          if (event.phase == phase_instant) fprintf(file, ",\"s\":\"t\"");
+          if (event.phase != phase_end)     fprintf(file, ",\"args\":{\"arg\":%lld}", event.arg);
+          fprintf(file, "}");
+          first = false;
+        }
+      }
+
+      fprintf(file, "\n]}\n");
+      fclose(file);
+      return(true);
+    }
+
+    void ExportToLogPath()
+    {
+      const std::string file_name = Util::GeteCALLogPath() + "ecal_trace_" + Process::GetUnitName() + "_" + std::to_string(Process::GetProcessID()) + ".json";
+      if (!Export(file_name))
+      {
+        Logging::Log(log_level_warning, "Trace::ExportToLogPath: could not write " + file_name);
+      }
+    }
+  }
+}
@@ -0,0 +1,117 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright (C) 2016 - 2019 Continental Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+/**
+ * @brief  eCAL hot path trace points
+ *
+ * Trace points are compiled in only if ECAL_CORE_TRACE is defined
+ * (cmake option ECAL_CORE_TRACE), otherwise all macros expand to nothing.
+ *
+ * Every thread records into its own ring buffer (no locking on the hot path),
+ * the buffers can be exported as Chrome trace / Perfetto JSON.
+**/
+
+#pragma once
+
+#include <string>
+
+namespace eCAL
+{
+  namespace Trace
+  {
+    enum eProbe
+    {
+      probe_writer_send = 0,
+      probe_writer_send_inproc,
+      probe_writer_send_shm,
+      probe_writer_send_udp_mc,
+      probe_writer_send_udp_uc,
+      probe_writer_send_lcm,
+      probe_writer_send_rtps,
+      probe_memfile_lock,
+      probe_memfile_unlock,
+      probe_event_set,
+      probe_event_wait,
+      probe_udp_fragment_out,
+      probe_udp_fragment_in,
+      probe_subgate_dispatch,
+      probe_reader_callback,
+      probe_count
+    };
+
+    enum ePhase
+    {
+      phase_begin   = 'B',
+      phase_end     = 'E',
+      phase_instant = 'i'
+    };
+
+    /**
+     * @brief Record a trace event into the ring buffer of the calling thread.
+     *
+     * @param probe_  The probe id.
+     * @param phase_  The event phase (begin, end, instant).
+     * @param arg_    Probe specific argument (size, clock, ..).
+    **/
+    void Record(eProbe probe_, ePhase phase_, long long arg_);
+
+    /**
+     * @brief Export the content of all thread ring buffers in Chrome trace JSON format.
+     *
+     * @param file_name_  The output file name.
+     *
+     * @return  True if succeeded.
+    **/
+    bool Export(const std::string& file_name_);
+
+    /**
+     * @brief Export all trace events to the eCAL log path (called on eCAL finalization).
+    **/
+    void ExportToLogPath();
+
+    class CScope
+    {
+    public:
+      CScope(eProbe probe_, long long arg_) : m_probe(probe_)
+      {
+        Record(m_probe, phase_begin, arg_);
+      };
+      ~CScope()
+      {
+        Record(m_probe, phase_end, 0);
+      };
+    private:
+      CScope(const CScope&);                 // prevent copy-construction
+      CScope& operator=(const CScope&);      // prevent assignment
+
+      eProbe m_probe;
+    };
+  }
+}
+
+#define ECAL_TRACE_CONCAT_(a_, b_) a_##b_
+#define ECAL_TRACE_CONCAT(a_, b_)  ECAL_TRACE_CONCAT_(a_, b_)
+
+#ifdef ECAL_CORE_TRACE
+#define ECAL_TRACE_SCOPE(probe_, arg_)   eCAL::Trace::CScope ECAL_TRACE_CONCAT(ecal_trace_scope_, __LINE__)(eCAL::Trace::probe_, static_cast<long long>(arg_))
+#define ECAL_TRACE_INSTANT(probe_, arg_) eCAL::Trace::Record(eCAL::Trace::probe_, eCAL::Trace::phase_instant, static_cast<long long>(arg_))
+#else
+#define ECAL_TRACE_SCOPE(probe_, arg_)
+#define ECAL_TRACE_INSTANT(probe_, arg_)
+#endif
@@ -313,6 +313,16 @@ extern "C"
     return(0);
   }
 
+  ECALC_API int eCAL_Monitoring_GetMonitoringDelta(long long since_version_, void* buf_, int buf_len_)
+  {
+    std::string buf;
+    if(eCAL::Monitoring::GetMonitoringDelta(since_version_, buf))
+    {
+      return(CopyBuffer(buf_, buf_len_, buf));
+    }
+    return(0);
+  }
+
   ECALC_API int eCAL_Monitoring_GetLogging(void* buf_, int buf_len_)
   {
     std::string buf;
@@ -537,6 +547,30 @@ extern "C"
     return(0);
   }
 
+  ECALC_API int eCAL_Pub_SetBatching(ECAL_HANDLE handle_, int max_messages_, int max_bytes_, int max_delay_ms_)
+  {
+    if (handle_ == NULL) return(0);
+    if ((max_messages_ < 0) || (max_bytes_ < 0)) return(0);
+    eCAL::CPublisher* pub = static_cast<eCAL::CPublisher*>(handle_);
+    if (pub->SetBatching(static_cast<size_t>(max_messages_), static_cast<size_t>(max_bytes_), max_delay_ms_)) return(1);
+    return(0);
+  }
+
+  ECALC_API int eCAL_Pub_SetCompressionUDP(ECAL_HANDLE handle_, enum eCompressionC compression_)
+  {
+    if (handle_ == NULL) return(0);
+    eCAL::CPublisher* pub = static_cast<eCAL::CPublisher*>(handle_);
+    if (pub->SetCompressionUDP(static_cast<eCAL::TLayer::eCompression>(compression_))) return(1);
+    return(0);
+  }
+
+  ECALC_API int eCAL_Pub_Flush(ECAL_HANDLE handle_)
+  {
+    if (handle_ == NULL) return(0);
+    eCAL::CPublisher* pub = static_cast<eCAL::CPublisher*>(handle_);
+    return(static_cast<int>(pub->Flush()));
+  }
+
   ECALC_API int eCAL_Pub_SetID(ECAL_HANDLE handle_, long long id_)
   {
     if (handle_ == NULL) return(0);
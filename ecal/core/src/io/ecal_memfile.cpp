@@ -25,7 +25,9 @@
 
 #include "ecal_def.h"
 #include "ecal_memfile.h"
+#include "ecal_trace.h"
 
+#include <stddef.h>
 #include <stdio.h>
 #include <string.h>
 #include <iostream>
@@ -39,6 +41,8 @@
 #include <fcntl.h>
 #include <unistd.h>
 #include <errno.h>
+#include <sys/syscall.h>
+#include <linux/mempolicy.h>
 
 #endif /* ECAL_OS_LINUX */
 
@@ -52,7 +56,9 @@ namespace eCAL
   bool AllocMemFile(const std::string& name_, const bool create_, SMemFileInfo& mem_file_info_);
   bool MapMemFile(const bool create_, SMemFileInfo& mem_file_info_);
   bool CheckMemFile(const size_t len_, const bool create_, SMemFileInfo& mem_file_info_);
+  bool RemapMemFile(const std::string& name_, const size_t len_, const bool create_, SMemFileInfo& mem_file_info_);
   bool UnMapMemFile(SMemFileInfo& mem_file_info_);
+  void AdviseMemFile(SMemFileInfo& mem_file_info_);
   bool DeAllocMemFile(SMemFileInfo& mem_file_info_);
   bool DestroyMemFile(const std::string& name_, const bool remove_);
   bool RemoveMemFile(const SMemFileInfo& mem_file_info_);
@@ -66,7 +72,8 @@ namespace eCAL
     m_created(false),
     m_opened(false),
     m_name(""),
-    m_memfile_info(new SMemFileInfo)
+    m_memfile_info(new SMemFileInfo),
+    m_remap_clock(0)
   {
   }
 
@@ -78,7 +85,7 @@ namespace eCAL
     delete m_memfile_info;
   }
 
-  bool CMemoryFile::Create(const char* name_, const bool create_, const size_t len_)
+  bool CMemoryFile::Create(const char* name_, const bool create_, const size_t len_, const SMemFileAttr& attr_)
   {
     assert((create_ && len_ > 0) || (!create_ && len_ == 0));
 
@@ -101,6 +108,7 @@ namespace eCAL
       m_memfile_info->mutex  = nullptr;
       m_header.max_data_size = 0;
       m_header.cur_data_size = 0;
+      m_memfile_info->attr   = attr_;
 
       // create memory file
       if(!CreateMemFile(name_, create_, len_ + sizeof(SMemFileHeader), *m_memfile_info))
@@ -193,6 +201,38 @@ namespace eCAL
     return(ret_state);
   }
 
+  bool CMemoryFile::Resize(const size_t len_)
+  {
+    if(!m_created)                                          return(false);
+    if(m_opened)                                            return(false);
+    if(!m_memfile_info->mem_address)                        return(false);
+    if(len_ <= static_cast<size_t>(m_header.max_data_size)) return(true);
+
+    // lock mutex, readers must not access the file while it is remapped
+    if(!LockMtx(&m_memfile_info->mutex, PUB_MEMFILE_CREATE_TO)) return(false);
+
+    // the header is rewritten after the remap, keep the generation
+    const unsigned long generation = static_cast<SMemFileHeader*>(m_memfile_info->mem_address)->generation;
+
+    bool resized = RemapMemFile(m_name, len_ + sizeof(SMemFileHeader), true, *m_memfile_info);
+    if(resized)
+    {
+      m_remap_clock          = g_memfile_map()->remap_clock;
+      m_header.max_data_size = (unsigned long)len_;
+      m_header.cur_data_size = 0;
+      m_header.generation    = generation + 1;
+
+      // write header
+      SMemFileHeader* pHeader = new (m_memfile_info->mem_address) SMemFileHeader;
+      *pHeader = m_header;
+    }
+
+    // unlock mutex
+    UnlockMtx(&m_memfile_info->mutex);
+
+    return(resized);
+  }
+
   bool CMemoryFile::Open(int timeout_)
   {
     if(m_opened)                     return(true);
@@ -201,7 +241,12 @@ namespace eCAL
     if(!g_memfile_map())             return(false);
 
     // lock mutex
-    if(!LockMtx(&m_memfile_info->mutex, timeout_))
+    bool locked(false);
+    {
+      ECAL_TRACE_SCOPE(probe_memfile_lock, timeout_);
+      locked = LockMtx(&m_memfile_info->mutex, timeout_);
+    }
+    if(!locked)
     {
 #ifndef NDEBUG
       printf("Could not lock memory file mutex: %s.\n\n", m_name.c_str());
@@ -209,30 +254,37 @@ namespace eCAL
       return(false);
     }
 
+    // another memory file object of this process remapped the shared
+    // map entry, so our mapping address may be outdated
+    if(m_remap_clock != g_memfile_map()->remap_clock)
+    {
+      RemapMemFile(m_name, 0, false, *m_memfile_info);
+      m_remap_clock = g_memfile_map()->remap_clock;
+    }
+
     // update header
+    const unsigned long generation = m_header.generation;
     SMemFileHeader* pHeader = static_cast<SMemFileHeader*>(m_memfile_info->mem_address);
     m_header = *pHeader;
 
-    // check size again
+    // the header of an older writer ends before the generation
+    if(m_header.hdr_size <= offsetof(SMemFileHeader, generation)) m_header.generation = 0;
+
+    // the writer resized the file in place ?
     size_t len = static_cast<size_t>(m_header.hdr_size) + static_cast<size_t>(m_header.max_data_size);
-    if(len > m_memfile_info->size)
+    if((m_header.generation != generation) || (len > m_memfile_info->size))
     {
-      // check memory file size
-      CheckMemFile(len, false, *m_memfile_info);
-
-      // update memory file map
-      {
-        std::lock_guard<std::mutex> lock(g_memfile_map()->sync);
-        g_memfile_map()->map[m_name] = *m_memfile_info;
-      }
+      // remap the memory file with the new size
+      RemapMemFile(m_name, len, false, *m_memfile_info);
+      m_remap_clock = g_memfile_map()->remap_clock;
+    }
 
-      // check size again and give up if it is still to small
-      if(len > m_memfile_info->size)
-      {
-        // unlock mutex
-        UnlockMtx(&m_memfile_info->mutex);
-        return(false);
-      }
+    // check size again and give up if it is still to small
+    if(len > m_memfile_info->size)
+    {
+      // unlock mutex
+      UnlockMtx(&m_memfile_info->mutex);
+      return(false);
     }
 
     // mark as opened
@@ -247,6 +299,7 @@ namespace eCAL
     if(!m_created) return(false);
 
     // unlock mutex
+    ECAL_TRACE_INSTANT(probe_memfile_unlock, 0);
     UnlockMtx(&m_memfile_info->mutex);
 
     // reset states
@@ -396,6 +449,37 @@ namespace eCAL
     return(true);
   }
 
+  bool RemapMemFile(const std::string& name_, const size_t len_, const bool create_, SMemFileInfo& mem_file_info_)
+  {
+    if (!g_memfile_map()) return(false);
+
+    // lock memory map access
+    std::lock_guard<std::mutex> lock(g_memfile_map()->sync);
+
+    // all memory file objects of this process share one mapping per file
+    MemFileMapT::iterator iter = g_memfile_map()->map.find(name_);
+    if(iter == g_memfile_map()->map.end()) return(false);
+
+    // grow the shared mapping if needed
+    if(len_ > iter->second.size)
+    {
+#ifdef ECAL_OS_WINDOWS
+      // named file mappings can not grow as long as any process holds them
+      if(create_) return(false);
+#endif
+      CheckMemFile(len_, create_, iter->second);
+      g_memfile_map()->remap_clock++;
+    }
+
+    // copy info from memory file map
+    mem_file_info_.memfile     = iter->second.memfile;
+    mem_file_info_.map_region  = iter->second.map_region;
+    mem_file_info_.mem_address = iter->second.mem_address;
+    mem_file_info_.size        = iter->second.size;
+
+    return((mem_file_info_.mem_address != nullptr) && (len_ <= mem_file_info_.size));
+  }
+
   bool DestroyMemFile(const std::string& name_, const bool remove_)
   {
     if (!g_memfile_map()) return(false);
@@ -611,14 +695,10 @@ namespace eCAL
         // set new file size
         mem_file_info_.size = len;
 
-        // and map memory file again
+        // and map memory file again, ftruncate zero fills the grown
+        // tail and the existing content is kept, so there is no need
+        // to touch (and fault in) the whole file here
         MapMemFile(create_, mem_file_info_);
-
-        // reset content
-        if(create_ && mem_file_info_.mem_address)
-        {
-          memset(mem_file_info_.mem_address, 0, len);
-        }
       }
     }
 
@@ -642,18 +722,59 @@ namespace eCAL
       int         prot  = PROT_READ;
       if(create_) prot |= PROT_WRITE;
 
-      mem_file_info_.mem_address = ::mmap(nullptr, mem_file_info_.size, prot, MAP_SHARED, mem_file_info_.memfile, 0);
+      // pages have to be placed by AdviseMemFile before they are faulted in,
+      // so MAP_POPULATE is only used if there is nothing to advise
+      const SMemFileAttr& attr = mem_file_info_.attr;
+      const bool advise = create_ && (attr.huge_pages || (attr.numa_node >= 0));
+      int flags = MAP_SHARED;
+      if(create_ && attr.populate && !advise) flags |= MAP_POPULATE;
+
+      mem_file_info_.mem_address = ::mmap(nullptr, mem_file_info_.size, prot, flags, mem_file_info_.memfile, 0);
       if(mem_file_info_.mem_address == MAP_FAILED)
       {
         mem_file_info_.mem_address = nullptr;
         std::cout << "mmap failed : " << mem_file_info_.name  << " errno: " << strerror(errno) << std::endl;
         return(false);
       }
+
+      if(advise) AdviseMemFile(mem_file_info_);
     }
 
     return(true);
   }
 
+  void AdviseMemFile(SMemFileInfo& mem_file_info_)
+  {
+    const SMemFileAttr& attr = mem_file_info_.attr;
+
+    // back the mapping with transparent huge pages
+    if(attr.huge_pages)
+    {
+      if(::madvise(mem_file_info_.mem_address, mem_file_info_.size, MADV_HUGEPAGE) != 0)
+      {
+        std::cout << "madvise failed : " << mem_file_info_.name << " errno: " << strerror(errno) << std::endl;
+      }
+    }
+
+    // bind the pages to the requested numa node
+    if((attr.numa_node >= 0) && (attr.numa_node < static_cast<int>(sizeof(unsigned long) * 8)))
+    {
+      unsigned long nodemask = 1UL << attr.numa_node;
+      if(::syscall(SYS_mbind, mem_file_info_.mem_address, mem_file_info_.size, MPOL_BIND, &nodemask, sizeof(nodemask) * 8, 0) != 0)
+      {
+        std::cout << "mbind failed : " << mem_file_info_.name << " errno: " << strerror(errno) << std::endl;
+      }
+    }
+
+    // prefault the pages with the placement applied
+    if(attr.populate)
+    {
+      const size_t page_size = static_cast<size_t>(sysconf(_SC_PAGE_SIZE));
+      volatile char* mem = static_cast<volatile char*>(mem_file_info_.mem_address);
+      for(size_t pos = 0; pos < mem_file_info_.size; pos += page_size) mem[pos] = mem[pos];
+    }
+  }
+
   bool UnMapMemFile(SMemFileInfo& mem_file_info_)
   {
     if(mem_file_info_.mem_address)
@@ -24,6 +24,7 @@
 #pragma once
 
 #include <string>
+#include <atomic>
 #include <memory>
 #include <unordered_map>
 #include <mutex>
@@ -50,6 +51,22 @@ typedef int  MapRegionT;
 
 namespace eCAL
 {
+  /**
+   * @brief Memory placement attributes applied by the creator of a memory file (linux only).
+  **/
+  struct SMemFileAttr
+  {
+    SMemFileAttr()
+    {
+      huge_pages = false;
+      populate   = false;
+      numa_node  = -1;
+    }
+    bool  huge_pages;  //!< advise transparent huge pages (needs shmem_enabled = advise)
+    bool  populate;    //!< prefault all pages on mapping
+    int   numa_node;   //!< bind the pages to this numa node (-1 = no binding)
+  };
+
   struct SMemFileInfo
   {
     SMemFileInfo()
@@ -70,13 +87,16 @@ namespace eCAL
     void*        mem_address;
     std::string  name;
     size_t       size;
+    SMemFileAttr attr;
   };
 
   typedef std::unordered_map<std::string, SMemFileInfo> MemFileMapT;
   struct SMemFileMap
   {
-    std::mutex  sync;
-    MemFileMapT map;
+    SMemFileMap() : remap_clock(0) {};
+    std::mutex                 sync;
+    MemFileMapT                map;
+    std::atomic<unsigned long> remap_clock;  // increased on every remap of a map entry
   };
 
   class CMemProducer
@@ -115,10 +135,11 @@ namespace eCAL
      * @param name_    Unique file name. 
      * @param create_  Add file to system if not exists.
      * @param len_     Number of bytes to allocate (only if add_ == true). 
+     * @param attr_    Memory placement attributes (only if add_ == true). 
      *
      * @return  true if it succeeds, false if it fails. 
     **/
-    bool Create(const char* name_, const bool create_, const size_t len_ = 0);
+    bool Create(const char* name_, const bool create_, const size_t len_ = 0, const SMemFileAttr& attr_ = SMemFileAttr());
 
     /**
      * @brief Delete the associated memory file from system. 
@@ -129,6 +150,19 @@ namespace eCAL
     **/
     bool Destroy(const bool remove_);
 
+    /**
+     * @brief Grow a created memory file in place, keeping its name.
+     *
+     * Connected readers detect the new size by the header generation
+     * and remap on their next Open call.
+     * Not supported on windows (file mappings can not grow).
+     *
+     * @param len_  New number of bytes to allocate.
+     *
+     * @return  true if it succeeds, false if the file has to be recreated.
+    **/
+    bool Resize(const size_t len_);
+
     /**
      * @brief Open the memory file. 
      *
@@ -214,10 +248,12 @@ namespace eCAL
         hdr_size      = sizeof(SMemFileHeader);
         cur_data_size = 0;
         max_data_size = 0;
+        generation    = 0;
       };
       unsigned short hdr_size;
       unsigned long  cur_data_size;
       unsigned long  max_data_size;
+      unsigned long  generation;     // increased on every in place resize
     };
 
   protected:
@@ -226,6 +262,7 @@ namespace eCAL
     std::string     m_name;
     SMemFileHeader  m_header;
     SMemFileInfo*   m_memfile_info;
+    unsigned long   m_remap_clock;
 
   private:
     CMemoryFile(const CMemoryFile&);                 // prevent copy-construction
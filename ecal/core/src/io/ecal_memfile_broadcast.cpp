@@ -0,0 +1,369 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright (C) 2016 - 2019 Continental Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+
+/**
+ * @brief  memory file broadcast signal
+**/
+
+#include <ecal/ecal_os.h>
+
+#include "ecal_memfile_broadcast.h"
+
+#include <chrono>
+#include <climits>
+#include <cstring>
+#include <new>
+#include <thread>
+#include <utility>
+
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+#include <immintrin.h>
+#define ECAL_CPU_RELAX() _mm_pause()
+#else
+#define ECAL_CPU_RELAX() std::this_thread::yield()
+#endif
+
+#ifdef ECAL_OS_LINUX
+#include <fcntl.h>
+#include <unistd.h>
+#include <linux/futex.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/syscall.h>
+#endif /* ECAL_OS_LINUX */
+
+namespace
+{
+#ifdef ECAL_OS_LINUX
+  // shared (not private) futex operations, the words are mapped by several processes
+  void futex_wait(std::atomic<uint32_t>* word_, uint32_t value_, int timeout_)
+  {
+    struct timespec ts;
+    ts.tv_sec  = timeout_ / 1000;
+    ts.tv_nsec = (timeout_ % 1000) * 1000000L;
+    syscall(SYS_futex, reinterpret_cast<uint32_t*>(word_), FUTEX_WAIT, value_, &ts, nullptr, 0);
+  }
+
+  void futex_wake_all(std::atomic<uint32_t>* word_)
+  {
+    syscall(SYS_futex, reinterpret_cast<uint32_t*>(word_), FUTEX_WAKE, INT_MAX, nullptr, nullptr, 0);
+  }
+#endif /* ECAL_OS_LINUX */
+
+  // sequence a_ is equal to or newer than b_ (wrap around safe)
+  bool seq_reached(uint32_t a_, uint32_t b_)
+  {
+    return(static_cast<int32_t>(a_ - b_) >= 0);
+  }
+}
+
+namespace eCAL
+{
+  CMemFileBroadcast::CMemFileBroadcast() :
+    m_state(nullptr),
+    m_process_id(0),
+    m_reader_slot(-1),
+    m_reader_seq(0)
+  {
+    memset(m_reader_pid,     0, sizeof(m_reader_pid));
+    memset(m_reader_timeout, 0, sizeof(m_reader_timeout));
+  }
+
+  CMemFileBroadcast::~CMemFileBroadcast()
+  {
+    Close(false);
+  }
+
+  bool CMemFileBroadcast::Create(const std::string& memfile_name_)
+  {
+    if (!Map(memfile_name_, true)) return(false);
+    memset(m_reader_pid,     0, sizeof(m_reader_pid));
+    memset(m_reader_timeout, 0, sizeof(m_reader_timeout));
+    return(true);
+  }
+
+  bool CMemFileBroadcast::Open(const std::string& memfile_name_, int process_id_)
+  {
+    if (!Map(memfile_name_, false)) return(false);
+    m_reader_seq = m_state->seq.load();
+    m_process_id = process_id_;
+    ClaimReaderSlot();
+    return(true);
+  }
+
+  void CMemFileBroadcast::Swap(CMemFileBroadcast& other_)
+  {
+    std::swap(m_name,           other_.m_name);
+    std::swap(m_state,          other_.m_state);
+    std::swap(m_process_id,     other_.m_process_id);
+    std::swap(m_reader_slot,    other_.m_reader_slot);
+    std::swap(m_reader_seq,     other_.m_reader_seq);
+    std::swap(m_reader_pid,     other_.m_reader_pid);
+    std::swap(m_reader_timeout, other_.m_reader_timeout);
+  }
+
+  void CMemFileBroadcast::Close(bool remove_)
+  {
+    if (m_state == nullptr) return;
+
+    // release the reader slot, if it was not handed to another subscriber
+    if (m_reader_slot >= 0)
+    {
+      int32_t pid(m_process_id);
+      m_state->reader[m_reader_slot].pid.compare_exchange_strong(pid, 0);
+      m_reader_slot = -1;
+    }
+
+#ifdef ECAL_OS_LINUX
+    munmap(static_cast<void*>(m_state), sizeof(SMemFileBroadcastState));
+    if (remove_) shm_unlink(m_name.c_str());
+#endif /* ECAL_OS_LINUX */
+
+    m_state = nullptr;
+    m_name.clear();
+  }
+
+  uint32_t CMemFileBroadcast::Publish()
+  {
+    if (m_state == nullptr) return(0);
+
+    // readers that missed an acknowledge timeout are waited for
+    // again as soon as they caught up with the last sequence
+    const uint32_t seq_last = m_state->seq.load();
+    for (int slot = 0; slot < PUB_MEMFILE_BC_READERS; ++slot)
+    {
+      if (m_reader_timeout[slot] && seq_reached(m_state->reader[slot].ack_seq, seq_last))
+      {
+        m_reader_timeout[slot] = false;
+      }
+    }
+
+    // one wake up for all subscribers
+    const uint32_t seq = m_state->seq.fetch_add(1) + 1;
+#ifdef ECAL_OS_LINUX
+    if (m_state->seq_waiters.load() > 0) futex_wake_all(&m_state->seq);
+#endif /* ECAL_OS_LINUX */
+    return(seq);
+  }
+
+  bool CMemFileBroadcast::WaitForAcknowledge(uint32_t seq_, int timeout_)
+  {
+    if (m_state == nullptr) return(false);
+
+    auto all_acknowledged = [this, seq_]()
+    {
+      bool acknowledged(true);
+      for (int slot = 0; slot < PUB_MEMFILE_BC_READERS; ++slot)
+      {
+        const int32_t pid = m_state->reader[slot].pid;
+        // a new reader in the slot starts without timeout
+        if (pid != m_reader_pid[slot])
+        {
+          m_reader_pid[slot]     = pid;
+          m_reader_timeout[slot] = false;
+        }
+        if ((pid == 0) || m_reader_timeout[slot]) continue;
+        acknowledged &= seq_reached(m_state->reader[slot].ack_seq, seq_);
+      }
+      return(acknowledged);
+    };
+
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(timeout_);
+    m_state->ack_waiters++;
+    bool acknowledged(false);
+    for (;;)
+    {
+      const uint32_t ack_clock = m_state->ack_clock.load();
+      acknowledged = all_acknowledged();
+      if (acknowledged) break;
+
+      const auto remaining = std::chrono::duration_cast<std::chrono::milliseconds>(deadline - std::chrono::steady_clock::now()).count();
+      if (remaining <= 0) break;
+#ifdef ECAL_OS_LINUX
+      futex_wait(&m_state->ack_clock, ack_clock, static_cast<int>(remaining));
+#else
+      (void)ack_clock;
+      break;
+#endif /* ECAL_OS_LINUX */
+    }
+    m_state->ack_waiters--;
+
+    // do not wait for the late readers in the next calls
+    if (!acknowledged)
+    {
+      for (int slot = 0; slot < PUB_MEMFILE_BC_READERS; ++slot)
+      {
+        if ((m_reader_pid[slot] != 0) && !seq_reached(m_state->reader[slot].ack_seq, seq_))
+        {
+          m_reader_timeout[slot] = true;
+        }
+      }
+    }
+    return(acknowledged);
+  }
+
+  void CMemFileBroadcast::RemoveReader(int process_id_)
+  {
+    if (m_state == nullptr) return;
+
+    for (int slot = 0; slot < PUB_MEMFILE_BC_READERS; ++slot)
+    {
+      int32_t pid(process_id_);
+      m_state->reader[slot].pid.compare_exchange_strong(pid, 0);
+    }
+  }
+
+  bool CMemFileBroadcast::SpinForPublish(int spin_time_)
+  {
+    if (m_state == nullptr) return(false);
+
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::microseconds(spin_time_);
+    for (unsigned int loop = 0;; ++loop)
+    {
+      const uint32_t seq = m_state->seq.load(std::memory_order_acquire);
+      if (seq != m_reader_seq)
+      {
+        m_reader_seq = seq;
+        return(true);
+      }
+      ECAL_CPU_RELAX();
+
+      // do not read the clock on every poll
+      if (((loop & 0x3f) == 0) && (std::chrono::steady_clock::now() >= deadline)) return(false);
+    }
+  }
+
+  bool CMemFileBroadcast::WaitForPublish(int timeout_)
+  {
+    if (m_state == nullptr) return(false);
+
+    if (m_state->seq.load() == m_reader_seq)
+    {
+#ifdef ECAL_OS_LINUX
+      m_state->seq_waiters++;
+      futex_wait(&m_state->seq, m_reader_seq, timeout_);
+      m_state->seq_waiters--;
+#endif /* ECAL_OS_LINUX */
+    }
+
+    const uint32_t seq = m_state->seq.load();
+    if (seq == m_reader_seq)
+    {
+      // an idle subscriber gets its slot back here,
+      // or a free one if the table was full before
+      if (m_reader_slot < 0) ClaimReaderSlot();
+      else                   CheckReaderSlot();
+      return(false);
+    }
+    m_reader_seq = seq;
+    return(true);
+  }
+
+  void CMemFileBroadcast::Acknowledge()
+  {
+    if (m_state == nullptr) return;
+
+    CheckReaderSlot();
+    if (m_reader_slot < 0)  return;
+
+    m_state->reader[m_reader_slot].ack_seq = m_reader_seq;
+    m_state->ack_clock++;
+#ifdef ECAL_OS_LINUX
+    if (m_state->ack_waiters.load() > 0) futex_wake_all(&m_state->ack_clock);
+#endif /* ECAL_OS_LINUX */
+  }
+
+  bool CMemFileBroadcast::ClaimReaderSlot()
+  {
+    // claim a free reader slot, starting acknowledged
+    // with the current sequence number
+    m_reader_slot = -1;
+    for (int slot = 0; slot < PUB_MEMFILE_BC_READERS; ++slot)
+    {
+      int32_t free_pid(0);
+      auto& reader = m_state->reader[slot];
+      if (reader.pid.load() == m_process_id || reader.pid.compare_exchange_strong(free_pid, m_process_id))
+      {
+        reader.ack_seq = m_reader_seq;
+        m_reader_slot  = slot;
+        return(true);
+      }
+    }
+    return(false);
+  }
+
+  void CMemFileBroadcast::CheckReaderSlot()
+  {
+    // the publisher releases the slots of subscribers it considers gone
+    // (RemoveReader), the slot may even belong to another subscriber now
+    if ((m_reader_slot >= 0) && (m_state->reader[m_reader_slot].pid.load() != m_process_id))
+    {
+      ClaimReaderSlot();
+    }
+  }
+
+  bool CMemFileBroadcast::Map(const std::string& memfile_name_, bool create_)
+  {
+    Close(false);
+
+#ifdef ECAL_OS_LINUX
+    const std::string name = memfile_name_ + "_bc";
+
+    int oflag = O_RDWR;
+    if (create_) oflag |= O_CREAT | O_EXCL;
+    const mode_t mode = S_IRUSR | S_IWUSR | S_IRGRP | S_IWGRP | S_IROTH | S_IWOTH;
+    int fd = shm_open(name.c_str(), oflag, mode);
+    if (fd < 0) return(false);
+
+    // the creation mode is restricted by the umask, but subscribers
+    // of other users have to acknowledge in the state as well
+    if (create_ && (fchmod(fd, mode) != 0))
+    {
+      close(fd);
+      shm_unlink(name.c_str());
+      return(false);
+    }
+
+    if (create_ && (ftruncate(fd, sizeof(SMemFileBroadcastState)) != 0))
+    {
+      close(fd);
+      shm_unlink(name.c_str());
+      return(false);
+    }
+
+    void* address = mmap(nullptr, sizeof(SMemFileBroadcastState), PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    close(fd);
+    if (address == MAP_FAILED)
+    {
+      if (create_) shm_unlink(name.c_str());
+      return(false);
+    }
+
+    // the truncated file is zero filled, which is a valid initial state
+    m_state = create_ ? new (address) SMemFileBroadcastState : static_cast<SMemFileBroadcastState*>(address);
+    m_name  = name;
+    return(true);
+#else
+    (void)memfile_name_;
+    (void)create_;
+    return(false);
+#endif /* ECAL_OS_LINUX */
+  }
+}
@@ -0,0 +1,151 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright (C) 2016 - 2019 Continental Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+
+/**
+ * @brief  memory file broadcast signal (one wake up for all local subscribers)
+**/
+
+#pragma once
+
+#include "ecal_def.h"
+
+#include <atomic>
+#include <cstdint>
+#include <string>
+
+namespace eCAL
+{
+  /**
+   * @brief Shared state of a memory file broadcast, placed in its own small shared
+   *        memory file beside the memory file (the memory file itself may be remapped).
+  **/
+  struct SMemFileBroadcastState
+  {
+    std::atomic<uint32_t>  seq;              // publish sequence (futex word)
+    std::atomic<uint32_t>  seq_waiters;      // number of subscribers waiting for seq
+    std::atomic<uint32_t>  ack_clock;        // increased on every acknowledge (futex word)
+    std::atomic<uint32_t>  ack_waiters;      // publisher waits for ack_clock
+    struct SReader
+    {
+      std::atomic<int32_t>  pid;             // subscriber process id (0 = free slot)
+      std::atomic<uint32_t> ack_seq;         // last acknowledged publish sequence
+    } reader[PUB_MEMFILE_BC_READERS];
+  };
+
+  /**
+   * @brief Memory file broadcast signal.
+   *
+   * The publisher increases a sequence counter and wakes all waiting subscribers with a
+   * single futex call, subscribers acknowledge by storing the sequence in their reader slot.
+   * Only available on linux, Create and Open fail on other platforms.
+  **/
+  class CMemFileBroadcast
+  {
+  public:
+    CMemFileBroadcast();
+    ~CMemFileBroadcast();
+
+    /**
+     * @brief Create the broadcast state of a memory file (publisher).
+    **/
+    bool Create(const std::string& memfile_name_);
+
+    /**
+     * @brief Open the broadcast state of a memory file and claim a reader slot (subscriber).
+     *
+     * Subscribers without a free reader slot are woken up too, but are not acknowledged.
+    **/
+    bool Open(const std::string& memfile_name_, int process_id_);
+
+    /**
+     * @brief Release the reader slot and unmap the state, remove it from system if requested.
+    **/
+    void Close(bool remove_);
+
+    bool IsOpened() const { return(m_state != nullptr); };
+
+    /**
+     * @brief Exchange the state with another broadcast object (publisher memory file handoff).
+    **/
+    void Swap(CMemFileBroadcast& other_);
+
+    /**
+     * @brief Publish a new sequence number and wake up all waiting subscribers.
+     *
+     * @return  The published sequence number.
+    **/
+    uint32_t Publish();
+
+    /**
+     * @brief Wait until all active reader slots acknowledged the sequence number.
+     *
+     * Readers missing the timeout are not waited for until they acknowledged again.
+     *
+     * @return  True if all readers acknowledged in time.
+    **/
+    bool WaitForAcknowledge(uint32_t seq_, int timeout_);
+
+    /**
+     * @brief Release the reader slot of a disconnected subscriber process.
+    **/
+    void RemoveReader(int process_id_);
+
+    /**
+     * @brief Wait for a new sequence number (subscriber).
+     *
+     * @return  True if a sequence number was published since the last call.
+    **/
+    bool WaitForPublish(int timeout_);
+
+    /**
+     * @brief Busy poll for a new sequence number without blocking (subscriber).
+     *
+     * @param spin_time_  Poll time in microseconds.
+     *
+     * @return  True if a sequence number was published since the last call.
+    **/
+    bool SpinForPublish(int spin_time_);
+
+    /**
+     * @brief Acknowledge the last received sequence number (subscriber).
+     *
+     * If the publisher released the reader slot in the meantime (RemoveReader), a slot is
+     * claimed again, so the subscriber never acknowledges into a slot it does not own.
+    **/
+    void Acknowledge();
+
+  protected:
+    bool Map(const std::string& memfile_name_, bool create_);
+    bool ClaimReaderSlot();
+    void CheckReaderSlot();
+
+    std::string              m_name;
+    SMemFileBroadcastState*  m_state;
+    int32_t                  m_process_id;
+    int                      m_reader_slot;
+    uint32_t                 m_reader_seq;
+    int32_t                  m_reader_pid[PUB_MEMFILE_BC_READERS];
+    bool                     m_reader_timeout[PUB_MEMFILE_BC_READERS];
+
+  private:
+    CMemFileBroadcast(const CMemFileBroadcast&);                 // prevent copy-construction
+    CMemFileBroadcast& operator=(const CMemFileBroadcast&);      // prevent assignment
+  };
+}
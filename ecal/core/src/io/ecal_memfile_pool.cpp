@@ -24,13 +24,22 @@
 #include <ecal/ecal.h>
 
 #include "ecal_def.h"
+#include "ecal_thread.h"
 #include "ecal_message.h"
 #include "pubsub/ecal_subgate.h"
 
 #include "ecal_memfile_pool.h"
+#include "ecal_memfile_broadcast.h"
 
+#include <algorithm>
+#include <cstddef>
 #include <iostream>
 
+#ifdef ECAL_OS_LINUX
+#include <pthread.h>
+#include <sched.h>
+#endif /* ECAL_OS_LINUX */
+
 namespace eCAL
 {
   ////////////////////////////////////////
@@ -39,7 +48,9 @@ namespace eCAL
   CMemFileObserver::CMemFileObserver() :
     m_do_stop(false),
     m_is_stopped(false),
-    m_timeout(0)
+    m_timeout(0),
+    m_spin_time(0),
+    m_spin_cpu(-1)
   {
   }
 
@@ -52,10 +63,19 @@ namespace eCAL
     m_timeout = 0;
   }
 
+  void CMemFileObserver::SetOptions(const SMemFileObserverOpt& observer_opt_)
+  {
+    m_spin_time = observer_opt_.spin_time;
+    m_spin_cpu  = observer_opt_.spin_cpu;
+  }
+
   void CMemFileObserver::Stop()
   {
     if(m_is_stopped) return;
 
+    // the event may be switched by a memory file generation handoff
+    std::lock_guard<std::mutex> lock(m_thread_sync);
+
     // signal to stop and
     m_do_stop = true;
 
@@ -63,30 +83,118 @@ namespace eCAL
     gSetEvent(m_event_snd);
   }
 
+  bool CMemFileObserver::IsObserving(const std::string& memfile_event_)
+  {
+    std::lock_guard<std::mutex> lock(m_thread_sync);
+    return(m_memfile_event == memfile_event_);
+  }
+
+  void CMemFileObserver::PinThread(const std::string& topic_name_, int spin_cpu_)
+  {
+#ifdef ECAL_OS_LINUX
+    // affinity of the shm receive class, restored when the subscribers drop the pinning
+    static thread_local bool      class_cpu_set_valid(false);
+    static thread_local cpu_set_t class_cpu_set;
+    if(!class_cpu_set_valid)
+    {
+      class_cpu_set_valid = pthread_getaffinity_np(pthread_self(), sizeof(class_cpu_set), &class_cpu_set) == 0;
+    }
+
+    if(spin_cpu_ < 0)
+    {
+      if(class_cpu_set_valid) pthread_setaffinity_np(pthread_self(), sizeof(class_cpu_set), &class_cpu_set);
+      return;
+    }
+
+    // CPU_SET does not check the range of the cpu index
+    bool pinned(false);
+    if(spin_cpu_ < CPU_SETSIZE)
+    {
+      cpu_set_t cpu_set;
+      CPU_ZERO(&cpu_set);
+      CPU_SET(spin_cpu_, &cpu_set);
+      pinned = pthread_setaffinity_np(pthread_self(), sizeof(cpu_set), &cpu_set) == 0;
+    }
+    if(!pinned)
+    {
+      Logging::Log(log_level_warning, std::string(topic_name_ + "::MemFile Thread - could not pin to cpu " + std::to_string(spin_cpu_)));
+    }
+#else  /* ECAL_OS_LINUX */
+    (void)topic_name_;
+    (void)spin_cpu_;
+#endif /* ECAL_OS_LINUX */
+  }
+
   void CMemFileObserver::Observe(const std::string& topic_name_, const std::string& memfile_name_, const std::string& memfile_event_, const int timeout_max_)
   {
 #ifndef NDEBUG
     // log it
     Logging::Log(log_level_debug2, std::string(topic_name_ + "::MemFile Thread Started (" + memfile_name_ + ", " + memfile_event_ + ")"));
 #endif
-    // open memory file event
-    gOpenEvent(&m_event_snd, memfile_event_);
-    gOpenEvent(&m_event_ack, memfile_event_ + "_ack");
+    // thread name, scheduling and affinity of the shm receive class
+    SetCurrentThreadAttr(Thread::thread_class_shm_receive, "ecal_shm_rcv");
+
+    // pin observer thread to the cpu requested by the subscriber qos,
+    // the subscribers of the topic may change it while we are running
+    int pinned_cpu = m_spin_cpu;
+    if(pinned_cpu >= 0) PinThread(topic_name_, pinned_cpu);
+
+    // current memory file generation
+    std::string memfile_name  = memfile_name_;
+    std::string memfile_event = memfile_event_;
+    {
+      std::lock_guard<std::mutex> lock(m_thread_sync);
+      m_memfile_event = memfile_event;
+
+      // open memory file event
+      gOpenEvent(&m_event_snd, memfile_event);
+      gOpenEvent(&m_event_ack, memfile_event + "_ack");
+    }
 
     // create memory file
     CMemoryFile memfile;
-    memfile.Create(memfile_name_.c_str(), false);
+    memfile.Create(memfile_name.c_str(), false);
+
+    // open the publisher broadcast signal, if the publisher
+    // does not provide one we are synchronized by the events
+    CMemFileBroadcast broadcast;
+    broadcast.Open(memfile_name, Process::GetProcessID());
 
     uint64_t sample_clock = 0;
     while((m_timeout < timeout_max_) && !m_do_stop)
     {
+      // apply changed observer options
+      const int spin_time = m_spin_time;
+      const int spin_cpu  = m_spin_cpu;
+      if(spin_cpu != pinned_cpu)
+      {
+        PinThread(topic_name_, spin_cpu);
+        pinned_cpu = spin_cpu;
+      }
+
       // central memory file event sync with 5 ms
       const int evt_timeout = 5;
-      if(gWaitForEvent(m_event_snd, evt_timeout))
+      bool signaled(false);
+      if(broadcast.IsOpened())
+      {
+        // busy poll the publisher sequence first to save the
+        // scheduler wake up latency of the blocking wait
+        if(spin_time > 0) signaled = broadcast.SpinForPublish(spin_time);
+        if(!signaled)                   signaled = broadcast.WaitForPublish(evt_timeout);
+      }
+      else
+      {
+        signaled = gWaitForEvent(m_event_snd, evt_timeout);
+      }
+      if(signaled)
       {
         std::lock_guard<std::mutex> lock(m_thread_sync);
         if(m_do_stop) break;
 
+        // the memory file of a handed over generation
+        // may not have been existing on the handoff
+        if(!memfile.IsCreated()) memfile.Create(memfile_name.c_str(), false);
+
         // try to open memory file with timeout 5 ms
         if(memfile.Open(5))
         {
@@ -96,12 +204,23 @@ namespace eCAL
           // retrieve size of received buffer
           size_t data_size = memfile.DataSize();
 
-          // if there are less data then size of the header struct, return false
-          if(data_size >= sizeof(SEcalMessage))
+          // read header from memory buffer, older publishers write a shorter
+          // header without the handoff and batch flags, so we need at least
+          // the fields up to the flags and the header size the publisher wrote
+          const size_t hdr_min_size = offsetof(SEcalMessage, handoff);
+          bool hdr_valid(false);
+          if(data_size >= hdr_min_size)
           {
-            // read header from memory buffer
-            memfile.Read(&ecal_message, sizeof(SEcalMessage), 0);
+            memfile.Read(&ecal_message, std::min(data_size, sizeof(SEcalMessage)), 0);
+            hdr_valid = (ecal_message.hdr_size >= hdr_min_size)
+                     && (ecal_message.hdr_size <= data_size)
+                     && (ecal_message.data_size <= data_size - ecal_message.hdr_size);
           }
+          if(!hdr_valid) ecal_message = SEcalMessage();
+
+          // the handoff flag is only valid for headers containing it
+          const bool handoff = (ecal_message.hdr_size > offsetof(SEcalMessage, handoff)) && (ecal_message.handoff != 0);
+          const bool batch   = (ecal_message.hdr_size > offsetof(SEcalMessage, batch))   && (ecal_message.batch   != 0);
 
           // read memory file content
           if(ecal_message.data_size > 0)
@@ -113,8 +232,37 @@ namespace eCAL
           // close memory file
           memfile.Close();
 
-          // send ack event
-          gSetEvent(m_event_ack);
+          // send acknowledge
+          if(broadcast.IsOpened()) broadcast.Acknowledge();
+          else                     gSetEvent(m_event_ack);
+
+          // memory file generation handoff, the publisher recreated its
+          // memory file and the content is the name of the new one
+          if(handoff && !m_ecal_buffer.empty())
+          {
+            const std::string event_postfix = memfile_event.substr(memfile_name.size());
+            memfile_name.assign(m_ecal_buffer.data(), m_ecal_buffer.size());
+            memfile_event = memfile_name + event_postfix;
+            m_memfile_event = memfile_event;
+            m_ecal_buffer.clear();
+
+            // switch events and memory file
+            gCloseEvent(m_event_snd);
+            gCloseEvent(m_event_ack);
+            gOpenEvent(&m_event_snd, memfile_event);
+            gOpenEvent(&m_event_ack, memfile_event + "_ack");
+            memfile.Destroy(false);
+            memfile.Create(memfile_name.c_str(), false);
+            broadcast.Open(memfile_name, Process::GetProcessID());
+            sample_clock = 0;
+#ifndef NDEBUG
+            // log it
+            Logging::Log(log_level_debug2, std::string(topic_name_ + "::MemFile Handoff (" + memfile_name + ", " + memfile_event + ")"));
+#endif
+            // reset timeout
+            m_timeout = 0;
+            continue;
+          }
 
           // process content
           if((m_ecal_buffer.size() > 0) && (ecal_message.clock > sample_clock))
@@ -126,7 +274,7 @@ namespace eCAL
             Logging::Log(log_level_debug3, std::string(topic_name_ + "::MemFile Read (" + std::to_string(m_ecal_buffer.size()) + " Bytes)"));
 #endif
             // add sample to data reader
-            if (g_subgate()) g_subgate()->ApplySample(topic_name_, memfile_name_, m_ecal_buffer.data(), m_ecal_buffer.size(), (long long)ecal_message.id, (long long)ecal_message.clock, (long long)ecal_message.time, (size_t)ecal_message.hash, eCAL::pb::tl_ecal_shm);
+            if (g_subgate()) g_subgate()->ApplySample(topic_name_, memfile_name, m_ecal_buffer.data(), m_ecal_buffer.size(), (long long)ecal_message.id, (long long)ecal_message.clock, (long long)ecal_message.time, (size_t)ecal_message.hash, eCAL::pb::tl_ecal_shm, batch);
           }
         }
 
@@ -135,27 +283,36 @@ namespace eCAL
       }
       else
       {
+        // the broadcast signal may not have been existing when we
+        // opened it, subscribers announcing broadcast support are
+        // not signaled by the events, so keep trying
+        if(!broadcast.IsOpened()) broadcast.Open(memfile_name, Process::GetProcessID());
+
         // increase timeout
         m_timeout += evt_timeout;
       }
     }
 
-    // destroy memory file
+    // destroy memory file and release broadcast reader slot
     memfile.Destroy(false);
+    broadcast.Close(false);
 
     // close memory file events
-    gCloseEvent(m_event_snd);
-    gCloseEvent(m_event_ack);
+    {
+      std::lock_guard<std::mutex> lock(m_thread_sync);
+      gCloseEvent(m_event_snd);
+      gCloseEvent(m_event_ack);
+    }
 
 #ifndef NDEBUG
     // log it
     if(m_do_stop)
     {
-      Logging::Log(log_level_debug2, std::string(topic_name_ + "::CMemFileObserver::ThreadFun(") + memfile_name_ + ", " + memfile_event_ + ") - STOPPED");
+      Logging::Log(log_level_debug2, std::string(topic_name_ + "::CMemFileObserver::ThreadFun(") + memfile_name + ", " + memfile_event + ") - STOPPED");
     }
     else
     {
-      Logging::Log(log_level_debug2, std::string(topic_name_ + "::CMemFileObserver::ThreadFun(") + memfile_name_ + ", " + memfile_event_ + ") - TIMEOUT");
+      Logging::Log(log_level_debug2, std::string(topic_name_ + "::CMemFileObserver::ThreadFun(") + memfile_name + ", " + memfile_event + ") - TIMEOUT");
     }
 #endif
     // mark as stopped
@@ -165,9 +322,11 @@ namespace eCAL
   ////////////////////////////////////////
   // CMemFileThread
   ////////////////////////////////////////
-  CMemFileThread::CMemFileThread(const std::string& topic_name_, const std::string& topic_id_, const std::string& memfile_name_, const std::string& memfile_event_, const int timeout_max_) :
+  CMemFileThread::CMemFileThread(const std::string& topic_name_, const std::string& topic_id_, const std::string& memfile_name_, const std::string& memfile_event_, const int timeout_max_, const SMemFileObserverOpt& observer_opt_) :
+    m_topic_name(topic_name_),
     m_topic_id(topic_id_)
   {
+    m_observer.SetOptions(observer_opt_);
     m_thread = std::thread(&CMemFileObserver::Observe, &m_observer, topic_name_, memfile_name_, memfile_event_, timeout_max_);
   }
 
@@ -195,11 +354,23 @@ namespace eCAL
     return(true);
   }
 
+  bool CMemFileThread::SetOptions(const SMemFileObserverOpt& observer_opt_)
+  {
+    if(m_observer.IsStopped()) return(false);
+    m_observer.SetOptions(observer_opt_);
+    return(true);
+  }
+
   bool CMemFileThread::IsStopped()
   {
     return(m_observer.IsStopped());
   }
 
+  bool CMemFileThread::IsObserving(const std::string& memfile_event_)
+  {
+    return(m_observer.IsObserving(memfile_event_));
+  }
+
   ////////////////////////////////////////
   // CMemFileThreadPool
   ////////////////////////////////////////
@@ -244,7 +415,7 @@ namespace eCAL
     m_created = false;
   }
 
-  bool CMemFileThreadPool::AssignThread(const std::string& topic_id_, const std::string& memfile_event_, const std::string& memfile_name_, const std::string& topic_name_)
+  bool CMemFileThreadPool::AssignThread(const std::string& topic_id_, const std::string& memfile_event_, const std::string& memfile_name_, const std::string& topic_name_, const SMemFileObserverOpt& observer_opt_)
   {
     if(!m_created)            return(false);
     if(memfile_name_.empty()) return(false);
@@ -268,16 +439,29 @@ namespace eCAL
       }
     }
 
-    // reset timeout for existing threads
+    // reset timeout and update options for existing threads
     auto thread_iter = m_thread_pool.find(memfile_event_);
     if(thread_iter != m_thread_pool.end())
     {
       thread_iter->second->ResetTimeout();
+      thread_iter->second->SetOptions(observer_opt_);
       return(true);
     }
 
+    // threads that followed a memory file generation handoff
+    // are still stored with the event name of their first generation
+    for(auto& thread : m_thread_pool)
+    {
+      if(thread.second->IsObserving(memfile_event_))
+      {
+        thread.second->ResetTimeout();
+        thread.second->SetOptions(observer_opt_);
+        return(true);
+      }
+    }
+
     // create a new thread for that topic id
-    CMemFileThread* thread = new CMemFileThread(topic_name_, topic_id_, memfile_name_, memfile_event_, CMN_REGISTRATION_TO);
+    CMemFileThread* thread = new CMemFileThread(topic_name_, topic_id_, memfile_name_, memfile_event_, CMN_REGISTRATION_TO, observer_opt_);
     m_thread_pool[memfile_event_] = thread;
 #ifndef NDEBUG
     // log it
@@ -285,4 +469,16 @@ namespace eCAL
 #endif
     return(true);
   }
+
+  void CMemFileThreadPool::SetObserverOptions(const std::string& topic_name_, const SMemFileObserverOpt& observer_opt_)
+  {
+    if(!m_created) return;
+
+    // all threads receiving this topic (one per publisher)
+    std::lock_guard<std::mutex> lock(m_thread_pool_sync);
+    for(auto& thread : m_thread_pool)
+    {
+      if(thread.second->GetTopicName() == topic_name_) thread.second->SetOptions(observer_opt_);
+    }
+  }
 }
@@ -36,6 +36,16 @@
 
 namespace eCAL
 {
+  ////////////////////////////////////////
+  // SMemFileObserverOpt
+  ////////////////////////////////////////
+  struct SMemFileObserverOpt
+  {
+    SMemFileObserverOpt() : spin_time(0), spin_cpu(-1) {};
+    int spin_time;  //!< busy poll time in us before blocking (0 = blocking only)
+    int spin_cpu;   //!< cpu the observer thread is pinned to (-1 = not pinned)
+  };
+
   ////////////////////////////////////////
   // CMemFileObserver
   ////////////////////////////////////////
@@ -46,16 +56,24 @@ namespace eCAL
     ~CMemFileObserver();
 
     void ResetTimeout();
+    void SetOptions(const SMemFileObserverOpt& observer_opt_);
     void Stop();
     bool IsStopped() {return(m_is_stopped);};
+    bool IsObserving(const std::string& memfile_event_);
 
     void Observe(const std::string& topic_name_, const std::string& memfile_name_, const std::string& memfile_event_, const int timeout_max_);
 
   protected:
+    void PinThread(const std::string& topic_name_, int spin_cpu_);
+
     std::mutex         m_thread_sync;
+    std::string        m_memfile_event;
     std::atomic<bool>  m_do_stop;
     std::atomic<bool>  m_is_stopped;
     std::atomic<int>   m_timeout;
+    // observer options, changed options are applied on the next loop
+    std::atomic<int>   m_spin_time;
+    std::atomic<int>   m_spin_cpu;
     EventHandleT       m_event_snd;
     EventHandleT       m_event_ack;
     CMemoryFile        m_memfile;
@@ -68,17 +86,21 @@ namespace eCAL
   class CMemFileThread
   {
   public:
-    CMemFileThread(const std::string& topic_name_, const std::string& topic_id_, const std::string& memfile_name_, const std::string& memfile_event_, const int timeout_max_);
+    CMemFileThread(const std::string& topic_name_, const std::string& topic_id_, const std::string& memfile_name_, const std::string& memfile_event_, const int timeout_max_, const SMemFileObserverOpt& observer_opt_);
     ~CMemFileThread();
 
     bool Stop();
     bool Join();
     bool ResetTimeout();
+    bool SetOptions(const SMemFileObserverOpt& observer_opt_);
     bool IsStopped();
+    bool IsObserving(const std::string& memfile_event_);
+    const std::string& GetTopicName() const {return(m_topic_name);};
 
   protected:
     std::thread       m_thread;
     CMemFileObserver  m_observer;
+    std::string       m_topic_name;
     std::string       m_topic_id;
   };
 
@@ -94,7 +116,8 @@ namespace eCAL
     void Create();
     void Destroy();
 
-    bool AssignThread(const std::string& topic_id_, const std::string& memfile_event_, const std::string& memfile_name_, const std::string& topic_name_);
+    bool AssignThread(const std::string& topic_id_, const std::string& memfile_event_, const std::string& memfile_name_, const std::string& topic_name_, const SMemFileObserverOpt& observer_opt_ = SMemFileObserverOpt());
+    void SetObserverOptions(const std::string& topic_name_, const SMemFileObserverOpt& observer_opt_);
 
   protected:
     std::atomic<bool>                       m_created;
@@ -37,6 +37,8 @@ namespace eCAL
       clock     = 0;
       time      = 0;
       hash      = 0;
+      handoff   = 0;
+      batch     = 0;
     };
     uint16_t  hdr_size;
     uint64_t  data_size;
@@ -44,5 +46,7 @@ namespace eCAL
     uint64_t  clock;
     int64_t   time;
     uint64_t  hash;
+    uint8_t   handoff;   // content is the name of the next memory file generation
+    uint8_t   batch;     // content is a batch frame of several samples
   };
 };
@@ -27,6 +27,7 @@
 
 #include "ecal_def.h"
 #include "rcv_sample.h"
+#include "ecal_trace.h"
 
 
 CReceiveSlot::CReceiveSlot()
@@ -243,6 +244,8 @@ int CSampleReceiver::Receive(eCAL::CUDPReceiver* sample_receiver_)
 
 int CSampleReceiver::Process(const char* sample_buffer_, size_t sample_buffer_len_)
 {
+  ECAL_TRACE_INSTANT(probe_udp_fragment_in, sample_buffer_len_);
+
   // cast buffer to udp message struct
   struct SUDPMessage* ecal_message = (struct SUDPMessage*)sample_buffer_;
 
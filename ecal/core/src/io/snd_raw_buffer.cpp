@@ -25,6 +25,7 @@
 
 #include "snd_raw_buffer.h"
 #include "io/msg_type.h"
+#include "ecal_trace.h"
 
 namespace
 {
@@ -98,6 +99,7 @@ namespace eCAL
       memcpy(buf_, &msg_header, sizeof(struct SUDPMessageHead));
 
       // send single header + data package
+      ECAL_TRACE_INSTANT(probe_udp_fragment_out, sizeof(struct SUDPMessageHead) + buf_len_);
       sent = transmit_cb_(buf_, sizeof(struct SUDPMessageHead) + buf_len_);
       if (sent == 0) return(sent);
       sent_sum += sent;
@@ -130,6 +132,7 @@ namespace eCAL
       msg_header.len = int32_t(buf_len_);
 
       // send start package
+      ECAL_TRACE_INSTANT(probe_udp_fragment_out, sizeof(struct SUDPMessageHead));
       sent = transmit_cb_(&msg_header, sizeof(struct SUDPMessageHead));
       if (sent == 0) return(sent);
       sent_sum += sent;
@@ -160,6 +163,7 @@ namespace eCAL
           memcpy(buf_ + static_cast<size_t>(current_packet_num)*MSG_PAYLOAD_SIZE, &msg_header, sizeof(struct SUDPMessageHead));
 
           // send data package
+          ECAL_TRACE_INSTANT(probe_udp_fragment_out, sizeof(struct SUDPMessageHead) + current_snd_len);
           sent = transmit_cb_(buf_ + static_cast<size_t>(current_packet_num)*MSG_PAYLOAD_SIZE, sizeof(struct SUDPMessageHead) + current_snd_len);
           if (sent == 0) return(sent);
           if (send_sleep_us)
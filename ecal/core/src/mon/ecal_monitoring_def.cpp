@@ -68,6 +68,11 @@ namespace eCAL
     m_monitoring_impl->GetMonitoringMsg(monitoring_);
   }
 
+  void CMonitoring::Monitor(long long since_version_, eCAL::pb::MonitoringDelta& monitoring_delta_)
+  {
+    m_monitoring_impl->GetMonitoringDeltaMsg(since_version_, monitoring_delta_);
+  }
+
   void CMonitoring::Monitor(eCAL::pb::Logging& logging_)
   {
     m_monitoring_impl->GetLoggingMsg(logging_);
@@ -121,6 +126,15 @@ namespace eCAL
       return((int)mon_.size());
     }
 
+    int GetMonitoringDelta(long long since_version_, std::string& mon_)
+    {
+      eCAL::pb::MonitoringDelta monitoring_delta;
+      if (g_monitoring()) g_monitoring()->Monitor(since_version_, monitoring_delta);
+
+      mon_ = monitoring_delta.SerializeAsString();
+      return((int)mon_.size());
+    }
+
     int GetLogging(std::string& log_)
     {
       eCAL::pb::Logging logging;
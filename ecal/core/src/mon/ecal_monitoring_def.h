@@ -55,6 +55,7 @@ namespace eCAL
     void SetFilterState(bool state_);
 
     void Monitor(eCAL::pb::Monitoring& monitoring_);
+    void Monitor(long long since_version_, eCAL::pb::MonitoringDelta& monitoring_delta_);
     void Monitor(eCAL::pb::Logging& logging_);
 
     int PubMonitoring(bool state_, std::string& name_);
@@ -77,7 +77,11 @@ namespace eCAL
     m_publisher_map (std::chrono::milliseconds(eCALPAR(MON, TIMEOUT))),
     m_subscriber_map(std::chrono::milliseconds(eCALPAR(MON, TIMEOUT))),
     m_process_map   (std::chrono::milliseconds(eCALPAR(MON, TIMEOUT))),
-    m_service_map   (std::chrono::milliseconds(eCALPAR(MON, TIMEOUT)))
+    m_service_map   (std::chrono::milliseconds(eCALPAR(MON, TIMEOUT))),
+    m_removed_timeout(std::chrono::milliseconds(eCALPAR(MON, TIMEOUT))),
+    m_stats_interval(std::chrono::milliseconds(eCALPAR(MON, STATS_INTERVAL))),
+    m_version(0),
+    m_removed_horizon(0)
   {
   }
 
@@ -288,6 +292,7 @@ namespace eCAL
       // try to get topic info
       std::string topic_name_id = topic_name + topic_id;
       STopicMon& TopicInfo = (*pTopicMap->map)[topic_name_id];
+      STopicMon  TopicInfoOld(TopicInfo);
 
       // set static content
       TopicInfo.hname  = std::move(host_name);
@@ -319,6 +324,9 @@ namespace eCAL
       TopicInfo.dfreq_max             = dfreq_max;
       TopicInfo.dfreq_min_err         = dfreq_min_err;
       TopicInfo.dfreq_max_err         = dfreq_max_err;
+      TopicInfo.tlstats               = sample_topic.tlstats();
+
+      UpdateVersion(TopicInfo, TopicInfoOld);
     }
 
     return(true);
@@ -333,6 +341,10 @@ namespace eCAL
     std::string     process_param                = sample_process.pparam();
     std::string     unit_name                    = sample_process.uname();
     long long       process_memory               = sample_process.pmemory();
+    long long       process_rss                  = sample_process.prss();
+    int             process_threads              = sample_process.pthreads();
+    long long       process_vcsw                 = sample_process.pvcsw();
+    long long       process_ivcsw                = sample_process.pivcsw();
     float           process_cpu                  = sample_process.pcpu();
     float           process_usrptime             = sample_process.usrptime();
     int             process_udpsbytes            = sample_process.udpsbytes();
@@ -352,6 +364,7 @@ namespace eCAL
 
     // try to get process info
     SProcessMon& ProcessInfo = (*m_process_map.map)[process_name_id];
+    SProcessMon  ProcessInfoOld(ProcessInfo);
 
     // set static content
     ProcessInfo.hname  = std::move(host_name);
@@ -363,6 +376,10 @@ namespace eCAL
     // update flexible content
     ProcessInfo.rclock++;
     ProcessInfo.pmemory              = process_memory;
+    ProcessInfo.prss                 = process_rss;
+    ProcessInfo.pthreads             = process_threads;
+    ProcessInfo.pvcsw                = process_vcsw;
+    ProcessInfo.pivcsw               = process_ivcsw;
     ProcessInfo.pcpu                 = process_cpu;
     ProcessInfo.usrptime             = process_usrptime;
     ProcessInfo.udpsbytes            = process_udpsbytes;
@@ -372,6 +389,8 @@ namespace eCAL
     ProcessInfo.state_info           = std::move(process_state_info);
     ProcessInfo.tsync_mode           = process_tsync_mode;
 
+    UpdateVersion(ProcessInfo, ProcessInfoOld);
+
     return(true);
   }
 
@@ -394,6 +413,7 @@ namespace eCAL
 
     // try to get service info
     SServiceMon& ServiceInfo = (*m_service_map.map)[service_name_id];
+    SServiceMon  ServiceInfoOld(ServiceInfo);
 
     // set static content
     ServiceInfo.hname    = std::move(host_name);
@@ -417,6 +437,8 @@ namespace eCAL
       ServiceInfo.methods.push_back(method);
     }
 
+    UpdateVersion(ServiceInfo, ServiceInfoOld);
+
     return(true);
   }
 
@@ -453,6 +475,45 @@ namespace eCAL
     MonitorTopics(m_subscriber_map, monitoring_, "subscriber");
   }
 
+  void CMonitoringImpl::GetMonitoringDeltaMsg(long long since_version_, eCAL::pb::MonitoringDelta& monitoring_delta_)
+  {
+    // clear protobuf object
+    monitoring_delta_.Clear();
+
+    // acquire access to all maps, so that version, removal
+    // horizon and content form one consistent snapshot
+    // (the registration functions lock only one map each)
+    std::lock_guard<std::mutex> process_lock(m_process_map.sync);
+    std::lock_guard<std::mutex> service_lock(m_service_map.sync);
+    std::lock_guard<std::mutex> pub_lock(m_publisher_map.sync);
+    std::lock_guard<std::mutex> sub_lock(m_subscriber_map.sync);
+
+    // purge timed out entities first, this moves the version
+    // and the removal horizon forward
+    RemoveDeprecated(m_process_map);
+    RemoveDeprecated(m_service_map);
+    RemoveDeprecated(m_publisher_map);
+    RemoveDeprecated(m_subscriber_map);
+
+    // everything that changed after this version will be
+    // part of the next delta
+    monitoring_delta_.set_version(m_version);
+
+    // a client that missed removals (or has no state yet)
+    // gets the complete monitoring state
+    if ((since_version_ <= 0) || (since_version_ < m_removed_horizon))
+    {
+      since_version_ = 0;
+      monitoring_delta_.set_full(true);
+    }
+
+    // write all changes to monitoring delta message object
+    MonitorProcsDelta(since_version_, monitoring_delta_);
+    MonitorServicesDelta(since_version_, monitoring_delta_);
+    MonitorTopicsDelta(m_publisher_map, since_version_, monitoring_delta_, "publisher");
+    MonitorTopicsDelta(m_subscriber_map, since_version_, monitoring_delta_, "subscriber");
+  }
+
   void CMonitoringImpl::GetLoggingMsg(eCAL::pb::Logging& logging_)
   {
     // clear protobuf object
@@ -491,232 +552,383 @@ namespace eCAL
     return 0;
   }
 
+  template <typename MonT>
+  void CMonitoringImpl::UpdateVersion(MonT& mon_, const MonT& mon_old_)
+  {
+    // caller has to hold the map sync of mon_
+
+    // new or changed content gets a new version, changed live
+    // statistics only once per statistics interval, so that the
+    // deltas stay small but still carry recent rates and counters
+    const auto now = std::chrono::steady_clock::now();
+    if ((mon_.version == 0)
+      || !mon_.SameContent(mon_old_)
+      || (!mon_.SameStatistics(mon_old_) && (now - mon_.stats_time >= m_stats_interval)))
+    {
+      mon_.version    = ++m_version;
+      mon_.stats_time = now;
+    }
+  }
+
+  template <typename MonMapT>
+  void CMonitoringImpl::RemoveDeprecated(MonMapT& map_)
+  {
+    // caller has to hold map_.sync
+
+    // remove timed out entities and remember them for delta requests
+    typedef typename decltype(map_.removed)::value_type RemovedMonT;
+    std::list<std::pair<std::string, decltype(RemovedMonT::entity)>> erased;
+    map_.map->remove_deprecated(&erased);
+    for (const auto& entity : erased)
+    {
+      map_.removed.emplace_back(RemovedMonT(++m_version, entity.second));
+    }
+
+    // forget removals that are older than the monitoring timeout,
+    // clients asking for an older version will get the full state
+    auto removed_limit = std::chrono::steady_clock::now() - m_removed_timeout;
+    while (!map_.removed.empty() && (map_.removed.front().time < removed_limit))
+    {
+      long long horizon(m_removed_horizon);
+      long long version(map_.removed.front().version);
+      while ((version > horizon) && !m_removed_horizon.compare_exchange_weak(horizon, version)) {}
+      map_.removed.pop_front();
+    }
+  }
+
   void CMonitoringImpl::MonitorProcs(eCAL::pb::Monitoring& monitoring_)
   {
     // acquire access
     std::lock_guard<std::mutex> lock(m_process_map.sync);
 
     // iterate map
-    m_process_map.map->remove_deprecated();
+    RemoveDeprecated(m_process_map);
     for (auto process : (*m_process_map.map))
     {
-      // add host
-      eCAL::pb::Process* pMonProcs = monitoring_.add_processes();
-
-      // registration clock
-      pMonProcs->set_rclock(process.second.rclock);
-
-      // host name
-      pMonProcs->set_hname(process.second.hname);
-
-      // process name
-      pMonProcs->set_pname(process.second.pname);
+      // add process
+      SetProcessMsg(process.second, monitoring_.add_processes());
+    }
+  }
 
-      // unit name
-      pMonProcs->set_uname(process.second.uname);
+  void CMonitoringImpl::MonitorServices(eCAL::pb::Monitoring& monitoring_)
+  {
+    // acquire access
+    std::lock_guard<std::mutex> lock(m_service_map.sync);
 
-      // process id
-      pMonProcs->set_pid(process.second.pid);
+    // iterate map
+    RemoveDeprecated(m_service_map);
+    for (auto service : (*m_service_map.map))
+    {
+      // add service
+      SetServiceMsg(service.second, monitoring_.add_services());
+    }
+  }
 
-      // process parameter
-      pMonProcs->set_pparam(process.second.pparam);
+  void CMonitoringImpl::MonitorTopics(STopicMonMap& map_, eCAL::pb::Monitoring& monitoring_, const std::string& direction_)
+  {
+    // acquire access
+    std::lock_guard<std::mutex> lock(map_.sync);
 
-      // process memory
-      pMonProcs->set_pmemory(process.second.pmemory);
+    // iterate map
+    RemoveDeprecated(map_);
+    for (auto topic : (*map_.map))
+    {
+      // add topic
+      SetTopicMsg(topic.second, direction_, monitoring_.add_topics());
+    }
+  }
 
-      // process cpu
-      pMonProcs->set_pcpu(process.second.pcpu);
+  void CMonitoringImpl::MonitorProcsDelta(long long since_version_, eCAL::pb::MonitoringDelta& monitoring_delta_)
+  {
+    // caller has to hold m_process_map.sync and purged it
 
-      // process user core time
-      pMonProcs->set_usrptime(process.second.usrptime);
+    // iterate map
+    for (auto process : (*m_process_map.map))
+    {
+      if (process.second.version <= since_version_) continue;
+      SetProcessMsg(process.second, monitoring_delta_.add_processes());
+    }
 
-      // process udp send bytes
-      pMonProcs->set_udpsbytes(process.second.udpsbytes);
+    // removed processes
+    if (monitoring_delta_.full()) return;
+    for (const auto& removed : m_process_map.removed)
+    {
+      if (removed.version <= since_version_) continue;
+      auto pMonRemoved = monitoring_delta_.add_removed_processes();
+      pMonRemoved->set_version(removed.version);
+      pMonRemoved->set_time(removed.rtime);
+      auto pMonProcs = pMonRemoved->mutable_process();
+      pMonProcs->set_hname(removed.entity.hname);
+      pMonProcs->set_pname(removed.entity.pname);
+      pMonProcs->set_uname(removed.entity.uname);
+      pMonProcs->set_pid(removed.entity.pid);
+    }
+  }
 
-      // process udp receive bytes
-      pMonProcs->set_udprbytes(process.second.udprbytes);
+  void CMonitoringImpl::MonitorServicesDelta(long long since_version_, eCAL::pb::MonitoringDelta& monitoring_delta_)
+  {
+    // caller has to hold m_service_map.sync and purged it
 
-      // state
-      auto state = pMonProcs->mutable_state();
+    // iterate map
+    for (auto service : (*m_service_map.map))
+    {
+      if (service.second.version <= since_version_) continue;
+      SetServiceMsg(service.second, monitoring_delta_.add_services());
+    }
 
-      // severity state
-      state->set_severity(eCAL::pb::eProcessSeverity(process.second.state_severity));
+    // removed services
+    if (monitoring_delta_.full()) return;
+    for (const auto& removed : m_service_map.removed)
+    {
+      if (removed.version <= since_version_) continue;
+      auto pMonRemoved = monitoring_delta_.add_removed_services();
+      pMonRemoved->set_version(removed.version);
+      pMonRemoved->set_time(removed.rtime);
+      auto pMonService = pMonRemoved->mutable_service();
+      pMonService->set_hname(removed.entity.hname);
+      pMonService->set_pname(removed.entity.pname);
+      pMonService->set_uname(removed.entity.uname);
+      pMonService->set_pid(removed.entity.pid);
+      pMonService->set_sname(removed.entity.sname);
+    }
+  }
 
-      // severity level
-      state->set_severity_level(eCAL::pb::eProcessSeverityLevel(process.second.state_severity_level));
+  void CMonitoringImpl::MonitorTopicsDelta(STopicMonMap& map_, long long since_version_, eCAL::pb::MonitoringDelta& monitoring_delta_, const std::string& direction_)
+  {
+    // caller has to hold map_.sync and purged it
 
-      // severity info
-      state->set_info(process.second.state_info);
+    // iterate map
+    for (auto topic : (*map_.map))
+    {
+      if (topic.second.version <= since_version_) continue;
+      SetTopicMsg(topic.second, direction_, monitoring_delta_.add_topics());
+    }
 
-      // time synchronization mode
-      pMonProcs->set_tsync_mode(eCAL::pb::eTSyncState(process.second.tsync_mode));
+    // removed topics
+    if (monitoring_delta_.full()) return;
+    for (const auto& removed : map_.removed)
+    {
+      if (removed.version <= since_version_) continue;
+      auto pMonRemoved = monitoring_delta_.add_removed_topics();
+      pMonRemoved->set_version(removed.version);
+      pMonRemoved->set_time(removed.rtime);
+      auto pMonTopic = pMonRemoved->mutable_topic();
+      pMonTopic->set_hname(removed.entity.hname);
+      pMonTopic->set_pid(removed.entity.pid);
+      pMonTopic->set_pname(removed.entity.pname);
+      pMonTopic->set_uname(removed.entity.uname);
+      pMonTopic->set_tid(removed.entity.tid);
+      pMonTopic->set_tname(removed.entity.tname);
+      pMonTopic->set_direction(direction_);
     }
   }
 
-  void CMonitoringImpl::MonitorServices(eCAL::pb::Monitoring& monitoring_)
+  void CMonitoringImpl::SetProcessMsg(const SProcessMon& process_, eCAL::pb::Process* pb_process_)
   {
-    // acquire access
-    std::lock_guard<std::mutex> lock(m_service_map.sync);
+    // registration clock
+    pb_process_->set_rclock(process_.rclock);
 
-    // iterate map
-    m_service_map.map->remove_deprecated();
-    for (auto service : (*m_service_map.map))
-    {
-      // add host
-      eCAL::pb::Service* pMonService = monitoring_.add_services();
+    // host name
+    pb_process_->set_hname(process_.hname);
 
-      // registration clock
-      pMonService->set_rclock(service.second.rclock);
+    // process name
+    pb_process_->set_pname(process_.pname);
 
-      // host name
-      pMonService->set_hname(service.second.hname);
+    // unit name
+    pb_process_->set_uname(process_.uname);
 
-      // process name
-      pMonService->set_pname(service.second.pname);
+    // process id
+    pb_process_->set_pid(process_.pid);
 
-      // unit name
-      pMonService->set_uname(service.second.uname);
+    // process parameter
+    pb_process_->set_pparam(process_.pparam);
 
-      // process id
-      pMonService->set_pid(service.second.pid);
+    // process memory
+    pb_process_->set_pmemory(process_.pmemory);
 
-      // service name
-      pMonService->set_sname(service.second.sname);
+    // process resident memory
+    pb_process_->set_prss(process_.prss);
 
-      // tcp port
-      pMonService->set_tcp_port(service.second.tcp_port);
+    // process thread count
+    pb_process_->set_pthreads(process_.pthreads);
 
-      // methods
-      for (auto method : service.second.methods)
-      {
-        eCAL::pb::Method* pMonMethod = pMonService->add_methods();
-        pMonMethod->set_mname(method.mname);
-        pMonMethod->set_req_type(method.req_type);
-        pMonMethod->set_resp_type(method.resp_type);
-        pMonMethod->set_call_count(method.call_count);
-      }
-    }
+    // process context switches
+    pb_process_->set_pvcsw(process_.pvcsw);
+    pb_process_->set_pivcsw(process_.pivcsw);
+
+    // process cpu
+    pb_process_->set_pcpu(process_.pcpu);
+
+    // process user core time
+    pb_process_->set_usrptime(process_.usrptime);
+
+    // process udp send bytes
+    pb_process_->set_udpsbytes(process_.udpsbytes);
+
+    // process udp receive bytes
+    pb_process_->set_udprbytes(process_.udprbytes);
+
+    // state
+    auto state = pb_process_->mutable_state();
+
+    // severity state
+    state->set_severity(eCAL::pb::eProcessSeverity(process_.state_severity));
+
+    // severity level
+    state->set_severity_level(eCAL::pb::eProcessSeverityLevel(process_.state_severity_level));
+
+    // severity info
+    state->set_info(process_.state_info);
+
+    // time synchronization mode
+    pb_process_->set_tsync_mode(eCAL::pb::eTSyncState(process_.tsync_mode));
   }
 
-  void CMonitoringImpl::MonitorTopics(STopicMonMap& map_, eCAL::pb::Monitoring& monitoring_, const std::string& direction_)
+  void CMonitoringImpl::SetServiceMsg(const SServiceMon& service_, eCAL::pb::Service* pb_service_)
   {
-    // acquire access
-    std::lock_guard<std::mutex> lock(map_.sync);
+    // registration clock
+    pb_service_->set_rclock(service_.rclock);
 
-    // iterate map
-    map_.map->remove_deprecated();
-    for (auto topic : (*map_.map))
+    // host name
+    pb_service_->set_hname(service_.hname);
+
+    // process name
+    pb_service_->set_pname(service_.pname);
+
+    // unit name
+    pb_service_->set_uname(service_.uname);
+
+    // process id
+    pb_service_->set_pid(service_.pid);
+
+    // service name
+    pb_service_->set_sname(service_.sname);
+
+    // tcp port
+    pb_service_->set_tcp_port(service_.tcp_port);
+
+    // methods
+    for (auto method : service_.methods)
     {
-      // add topic
-      eCAL::pb::Topic* pMonTopic = monitoring_.add_topics();
+      eCAL::pb::Method* pMonMethod = pb_service_->add_methods();
+      pMonMethod->set_mname(method.mname);
+      pMonMethod->set_req_type(method.req_type);
+      pMonMethod->set_resp_type(method.resp_type);
+      pMonMethod->set_call_count(method.call_count);
+    }
+  }
 
-      // registration clock
-      pMonTopic->set_rclock(topic.second.rclock);
+  void CMonitoringImpl::SetTopicMsg(const STopicMon& topic_, const std::string& direction_, eCAL::pb::Topic* pb_topic_)
+  {
+    // registration clock
+    pb_topic_->set_rclock(topic_.rclock);
 
-      // host name
-      pMonTopic->set_hname(topic.second.hname);
+    // host name
+    pb_topic_->set_hname(topic_.hname);
 
-      // process id
-      pMonTopic->set_pid(topic.second.pid);
+    // process id
+    pb_topic_->set_pid(topic_.pid);
 
-      // process name
-      pMonTopic->set_pname(topic.second.pname);
+    // process name
+    pb_topic_->set_pname(topic_.pname);
 
-      // unit name
-      pMonTopic->set_uname(topic.second.uname);
+    // unit name
+    pb_topic_->set_uname(topic_.uname);
 
-      // topic id
-      pMonTopic->set_tid(topic.second.tid);
+    // topic id
+    pb_topic_->set_tid(topic_.tid);
 
-      // topic name
-      pMonTopic->set_tname(topic.second.tname);
+    // topic name
+    pb_topic_->set_tname(topic_.tname);
 
-      // direction
-      pMonTopic->set_direction(direction_);
+    // direction
+    pb_topic_->set_direction(direction_);
 
-      // topic type
-      pMonTopic->set_ttype(topic.second.ttype);
+    // topic type
+    pb_topic_->set_ttype(topic_.ttype);
 
-      // topic transport layers
-      if (topic.second.tlayer_ecal_udp_mc)
-      {
-        auto tlayer = pMonTopic->add_tlayer();
-        tlayer->set_type(eCAL::pb::tl_ecal_udp_mc);
-        tlayer->set_confirmed(true);
-      }
-      if (topic.second.tlayer_ecal_udp_uc)
-      {
-        auto tlayer = pMonTopic->add_tlayer();
-        tlayer->set_type(eCAL::pb::tl_ecal_udp_uc);
-        tlayer->set_confirmed(true);
-      }
-      if (topic.second.tlayer_ecal_udp_metal)
-      {
-        auto tlayer = pMonTopic->add_tlayer();
-        tlayer->set_type(eCAL::pb::tl_ecal_udp_metal);
-        tlayer->set_confirmed(true);
-      }
-      if (topic.second.tlayer_ecal_shm)
-      {
-        auto tlayer = pMonTopic->add_tlayer();
-        tlayer->set_type(eCAL::pb::tl_ecal_shm);
-        tlayer->set_confirmed(true);
-      }
-      if (topic.second.tlayer_lcm)
-      {
-        auto tlayer = pMonTopic->add_tlayer();
-        tlayer->set_type(eCAL::pb::tl_lcm);
-        tlayer->set_confirmed(true);
-      }
-      if (topic.second.tlayer_rtps)
-      {
-        auto tlayer = pMonTopic->add_tlayer();
-        tlayer->set_type(eCAL::pb::tl_rtps);
-        tlayer->set_confirmed(true);
-      }
-      if (topic.second.tlayer_inproc)
-      {
-        auto tlayer = pMonTopic->add_tlayer();
-        tlayer->set_type(eCAL::pb::tl_inproc);
-        tlayer->set_confirmed(true);
-      }
+    // topic transport layers
+    if (topic_.tlayer_ecal_udp_mc)
+    {
+      auto tlayer = pb_topic_->add_tlayer();
+      tlayer->set_type(eCAL::pb::tl_ecal_udp_mc);
+      tlayer->set_confirmed(true);
+    }
+    if (topic_.tlayer_ecal_udp_uc)
+    {
+      auto tlayer = pb_topic_->add_tlayer();
+      tlayer->set_type(eCAL::pb::tl_ecal_udp_uc);
+      tlayer->set_confirmed(true);
+    }
+    if (topic_.tlayer_ecal_udp_metal)
+    {
+      auto tlayer = pb_topic_->add_tlayer();
+      tlayer->set_type(eCAL::pb::tl_ecal_udp_metal);
+      tlayer->set_confirmed(true);
+    }
+    if (topic_.tlayer_ecal_shm)
+    {
+      auto tlayer = pb_topic_->add_tlayer();
+      tlayer->set_type(eCAL::pb::tl_ecal_shm);
+      tlayer->set_confirmed(true);
+    }
+    if (topic_.tlayer_lcm)
+    {
+      auto tlayer = pb_topic_->add_tlayer();
+      tlayer->set_type(eCAL::pb::tl_lcm);
+      tlayer->set_confirmed(true);
+    }
+    if (topic_.tlayer_rtps)
+    {
+      auto tlayer = pb_topic_->add_tlayer();
+      tlayer->set_type(eCAL::pb::tl_rtps);
+      tlayer->set_confirmed(true);
+    }
+    if (topic_.tlayer_inproc)
+    {
+      auto tlayer = pb_topic_->add_tlayer();
+      tlayer->set_type(eCAL::pb::tl_inproc);
+      tlayer->set_confirmed(true);
+    }
 
-      // topic description
-      pMonTopic->set_tdesc(topic.second.tdesc);
+    // topic description
+    pb_topic_->set_tdesc(topic_.tdesc);
 
-      // topic size
-      pMonTopic->set_tsize(topic.second.tsize);
+    // topic size
+    pb_topic_->set_tsize(topic_.tsize);
 
-      // local connections
-      pMonTopic->set_connections_loc(topic.second.connections_loc);
+    // local connections
+    pb_topic_->set_connections_loc(topic_.connections_loc);
 
-      // external connections
-      pMonTopic->set_connections_ext(topic.second.connections_ext);
+    // external connections
+    pb_topic_->set_connections_ext(topic_.connections_ext);
 
-      // data id (publisher setid)
-      pMonTopic->set_did(topic.second.did);
+    // data id (publisher setid)
+    pb_topic_->set_did(topic_.did);
 
-      // data clock
-      pMonTopic->set_dclock(topic.second.dclock);
+    // data clock
+    pb_topic_->set_dclock(topic_.dclock);
 
-      // data dropped
-      pMonTopic->set_message_drops(google::protobuf::int32(topic.second.ddropped));
+    // data dropped
+    pb_topic_->set_message_drops(google::protobuf::int32(topic_.ddropped));
 
-      // data frequency
-      pMonTopic->set_dfreq(topic.second.dfreq);
+    // data frequency
+    pb_topic_->set_dfreq(topic_.dfreq);
 
-      // data frequency minimum
-      pMonTopic->set_dfreq_min(topic.second.dfreq_min);
+    // data frequency minimum
+    pb_topic_->set_dfreq_min(topic_.dfreq_min);
 
-      // data frequency maximum
-      pMonTopic->set_dfreq_max(topic.second.dfreq_max);
+    // data frequency maximum
+    pb_topic_->set_dfreq_max(topic_.dfreq_max);
 
-      // data frequency minimum violation error counter
-      pMonTopic->set_dfreq_min_err(topic.second.dfreq_min_err);
+    // data frequency minimum violation error counter
+    pb_topic_->set_dfreq_min_err(topic_.dfreq_min_err);
 
-      // data frequency maximum violation error counter
-      pMonTopic->set_dfreq_max_err(topic.second.dfreq_max_err);
-    }
+    // data frequency maximum violation error counter
+    pb_topic_->set_dfreq_max_err(topic_.dfreq_max_err);
+
+    // transport layer latency / jitter statistics
+    *pb_topic_->mutable_tlstats() = topic_.tlstats;
   }
 
   void CMonitoringImpl::Tokenize(const std::string& str, StrICaseSetT& tokens, const std::string& delimiters, bool trimEmpty)
@@ -23,11 +23,16 @@
 
 #pragma once
 
+#include <ecal/ecal_time.h>
+
 #include "ecal_monitoring_threads.h"
 
 #include "ecal_expmap.h"
 #include "io/rcv_sample.h"
 
+#include <atomic>
+#include <chrono>
+#include <list>
 #include <memory>
 #include <mutex>
 #include <string>
@@ -51,6 +56,7 @@ namespace eCAL
     void SetFilterState(bool state_);
 
     void GetMonitoringMsg(eCAL::pb::Monitoring& monitoring_);
+    void GetMonitoringDeltaMsg(long long since_version_, eCAL::pb::MonitoringDelta& monitoring_delta_);
     void GetLoggingMsg(eCAL::pb::Logging& logging_);
 
     int PubMonitoring(bool state_, std::string& name_);
@@ -95,6 +101,45 @@ namespace eCAL
         dfreq_max             = 0;
         dfreq_min_err         = 0;
         dfreq_max_err         = 0;
+        version               = 0;
+      };
+
+      // compare identity and configuration only, the data clock,
+      // frequency and drop counters change with every sample and are
+      // compared by SameStatistics (see CMonitoringImpl::UpdateVersion)
+      bool SameContent(const STopicMon& o_) const
+      {
+        return (hname                 == o_.hname)
+            && (pid                   == o_.pid)
+            && (pname                 == o_.pname)
+            && (uname                 == o_.uname)
+            && (domain                == o_.domain)
+            && (tname                 == o_.tname)
+            && (tid                   == o_.tid)
+            && (ttype                 == o_.ttype)
+            && (tdesc                 == o_.tdesc)
+            && (tlayer_ecal_udp_mc    == o_.tlayer_ecal_udp_mc)
+            && (tlayer_ecal_udp_uc    == o_.tlayer_ecal_udp_uc)
+            && (tlayer_ecal_udp_metal == o_.tlayer_ecal_udp_metal)
+            && (tlayer_ecal_shm       == o_.tlayer_ecal_shm)
+            && (tlayer_lcm            == o_.tlayer_lcm)
+            && (tlayer_rtps           == o_.tlayer_rtps)
+            && (tlayer_inproc         == o_.tlayer_inproc)
+            && (tsize                 == o_.tsize)
+            && (connections_loc       == o_.connections_loc)
+            && (connections_ext       == o_.connections_ext);
+      };
+
+      bool SameStatistics(const STopicMon& o_) const
+      {
+        return (did                   == o_.did)
+            && (dclock                == o_.dclock)
+            && (ddropped              == o_.ddropped)
+            && (dfreq                 == o_.dfreq)
+            && (dfreq_min             == o_.dfreq_min)
+            && (dfreq_max             == o_.dfreq_max)
+            && (dfreq_min_err         == o_.dfreq_min_err)
+            && (dfreq_max_err         == o_.dfreq_max_err);
       };
 
       int          rclock;
@@ -125,17 +170,38 @@ namespace eCAL
       long         dfreq_max;
       long         dfreq_min_err;
       long         dfreq_max_err;
+      google::protobuf::RepeatedPtrField<eCAL::pb::LayerStatistics> tlstats;
+      long long    version;
+      std::chrono::steady_clock::time_point stats_time;
     };
     typedef eCAL::Util::CExpMap<std::string, STopicMon> TopicMonMapT;
 
+    // entity removed from a monitoring map (kept for delta requests)
+    template <typename T>
+    struct SRemovedMon
+    {
+      SRemovedMon(long long version_, const T& entity_) :
+        version(version_),
+        rtime(eCAL::Time::GetMicroSeconds()),
+        time(std::chrono::steady_clock::now()),
+        entity(entity_)
+      {
+      };
+      long long                              version;
+      long long                              rtime;
+      std::chrono::steady_clock::time_point  time;
+      T                                      entity;
+    };
+
     struct STopicMonMap
     {
       explicit STopicMonMap(const std::chrono::milliseconds& timeout_) :
         map(new TopicMonMapT(timeout_))
       {
       };
-      std::mutex                     sync;
-      std::unique_ptr<TopicMonMapT>  map;
+      std::mutex                            sync;
+      std::unique_ptr<TopicMonMapT>         map;
+      std::list<SRemovedMon<STopicMon>>     removed;
     };
 
     struct SProcessMon
@@ -145,6 +211,10 @@ namespace eCAL
         rclock = 0;
         pid = 0;
         pmemory = 0;
+        prss = 0;
+        pthreads = 0;
+        pvcsw = 0;
+        pivcsw = 0;
         pcpu = 0.0f;
         usrptime = 0.0f;
         udpsbytes = 0;
@@ -152,6 +222,36 @@ namespace eCAL
         state_severity = 0;
         state_severity_level = 0;
         tsync_mode = 0;
+        version = 0;
+      };
+
+      // compare identity, configuration and state only, the resource
+      // and traffic counters change with every registration and are
+      // compared by SameStatistics (see CMonitoringImpl::UpdateVersion)
+      bool SameContent(const SProcessMon& o_) const
+      {
+        return (hname                == o_.hname)
+            && (pname                == o_.pname)
+            && (uname                == o_.uname)
+            && (pid                  == o_.pid)
+            && (pparam               == o_.pparam)
+            && (state_severity       == o_.state_severity)
+            && (state_severity_level == o_.state_severity_level)
+            && (state_info           == o_.state_info)
+            && (tsync_mode           == o_.tsync_mode);
+      };
+
+      bool SameStatistics(const SProcessMon& o_) const
+      {
+        return (pmemory              == o_.pmemory)
+            && (prss                 == o_.prss)
+            && (pthreads             == o_.pthreads)
+            && (pvcsw                == o_.pvcsw)
+            && (pivcsw               == o_.pivcsw)
+            && (pcpu                 == o_.pcpu)
+            && (usrptime             == o_.usrptime)
+            && (udpsbytes            == o_.udpsbytes)
+            && (udprbytes            == o_.udprbytes);
       };
 
       int            rclock;
@@ -161,6 +261,10 @@ namespace eCAL
       int            pid;
       std::string    pparam;
       long long      pmemory;
+      long long      prss;
+      int            pthreads;
+      long long      pvcsw;
+      long long      pivcsw;
       float          pcpu;
       float          usrptime;
       int            udpsbytes;
@@ -169,6 +273,8 @@ namespace eCAL
       int            state_severity_level;
       std::string    state_info;
       int            tsync_mode;
+      long long      version;
+      std::chrono::steady_clock::time_point stats_time;
     };
     typedef eCAL::Util::CExpMap<std::string, SProcessMon> ProcessMonMapT;
 
@@ -178,8 +284,9 @@ namespace eCAL
         map(new ProcessMonMapT(timeout_))
       {
       };
-      std::mutex                       sync;
-      std::unique_ptr<ProcessMonMapT>  map;
+      std::mutex                          sync;
+      std::unique_ptr<ProcessMonMapT>     map;
+      std::list<SRemovedMon<SProcessMon>> removed;
     };
 
     struct SMethodMon
@@ -192,6 +299,12 @@ namespace eCAL
       std::string  req_type;
       std::string  resp_type;
       long long    call_count;
+
+      // the call count is not compared, it changes with every call
+      bool operator==(const SMethodMon& o_) const
+      {
+        return (mname == o_.mname) && (req_type == o_.req_type) && (resp_type == o_.resp_type);
+      };
     };
 
     struct SServiceMon
@@ -201,6 +314,30 @@ namespace eCAL
         rclock   = 0;
         pid      = 0;
         tcp_port = 0;
+        version  = 0;
+      };
+
+      // compare identity and configuration only (no call counters)
+      bool SameContent(const SServiceMon& o_) const
+      {
+        return (hname    == o_.hname)
+            && (sname    == o_.sname)
+            && (pname    == o_.pname)
+            && (uname    == o_.uname)
+            && (pid      == o_.pid)
+            && (tcp_port == o_.tcp_port)
+            && (methods  == o_.methods);
+      };
+
+      // compare the call counters (same methods assumed)
+      bool SameStatistics(const SServiceMon& o_) const
+      {
+        if (methods.size() != o_.methods.size()) return(false);
+        for (size_t i = 0; i < methods.size(); ++i)
+        {
+          if (methods[i].call_count != o_.methods[i].call_count) return(false);
+        }
+        return(true);
       };
 
       int                      rclock;
@@ -211,6 +348,8 @@ namespace eCAL
       int                      pid;
       int                      tcp_port;
       std::vector<SMethodMon>  methods;
+      long long                version;
+      std::chrono::steady_clock::time_point stats_time;
     };
     typedef eCAL::Util::CExpMap<std::string, SServiceMon> ServiceMonMapT;
 
@@ -220,8 +359,9 @@ namespace eCAL
         map(new ServiceMonMapT(timeout_))
       {
       };
-      std::mutex                       sync;
-      std::unique_ptr<ServiceMonMapT>  map;
+      std::mutex                          sync;
+      std::unique_ptr<ServiceMonMapT>     map;
+      std::list<SRemovedMon<SServiceMon>> removed;
     };
 
     struct InsensitiveCompare
@@ -240,11 +380,24 @@ namespace eCAL
 
     STopicMonMap* GetMap(enum ePubSub pubsub_type_);
 
+    template <typename MonT>
+    void UpdateVersion(MonT& mon_, const MonT& mon_old_);
+
+    template <typename MonMapT>
+    void RemoveDeprecated(MonMapT& map_);
 
     void MonitorProcs(eCAL::pb::Monitoring& monitoring_);
     void MonitorServices(eCAL::pb::Monitoring& monitoring_);
     void MonitorTopics(STopicMonMap& map_, eCAL::pb::Monitoring& monitoring_, const std::string& direction_);
 
+    void MonitorProcsDelta(long long since_version_, eCAL::pb::MonitoringDelta& monitoring_delta_);
+    void MonitorServicesDelta(long long since_version_, eCAL::pb::MonitoringDelta& monitoring_delta_);
+    void MonitorTopicsDelta(STopicMonMap& map_, long long since_version_, eCAL::pb::MonitoringDelta& monitoring_delta_, const std::string& direction_);
+
+    static void SetProcessMsg(const SProcessMon& process_, eCAL::pb::Process* pb_process_);
+    static void SetServiceMsg(const SServiceMon& service_, eCAL::pb::Service* pb_service_);
+    static void SetTopicMsg(const STopicMon& topic_, const std::string& direction_, eCAL::pb::Topic* pb_topic_);
+
     void Tokenize(const std::string& str, StrICaseSetT& tokens, const std::string& delimiters, bool trimEmpty);
 
     bool                                         m_init;
@@ -265,6 +418,12 @@ namespace eCAL
     SProcessMonMap                               m_process_map;
     SServiceMonMap                               m_service_map;
 
+    // versioning (for delta requests)
+    std::chrono::milliseconds                    m_removed_timeout;
+    std::chrono::milliseconds                    m_stats_interval;
+    std::atomic<long long>                       m_version;
+    std::atomic<long long>                       m_removed_horizon;
+
     // logging
     typedef std::list<eCAL::pb::LogMessage> LogMessageListT;
     std::mutex                                   m_log_msglist_sync;
@@ -50,7 +50,7 @@ namespace eCAL
     attr.rcvbuf     = eCALPAR(NET, UDP_MULTICAST_RCVBUF);
     attr.local_only = !eCALPAR(NET, ENABLED);
     m_reg_rcv.Create(attr);
-    m_reg_rcv_thread.Start(0, std::bind(&CRegistrationReceiveThread::ThreadFun, this));
+    m_reg_rcv_thread.Start(0, std::bind(&CRegistrationReceiveThread::ThreadFun, this), Thread::thread_class_monitoring, "ecal_mon_reg");
   }
 
   CRegistrationReceiveThread::~CRegistrationReceiveThread()
@@ -75,7 +75,7 @@ namespace eCAL
     attr.rcvbuf     = eCALPAR(NET, UDP_MULTICAST_RCVBUF);
     attr.local_only = !eCALPAR(NET, ENABLED);
     m_log_rcv.Create(attr);
-    m_log_rcv_thread.Start(0, std::bind(&CLoggingReceiveThread::ThreadFun, this));
+    m_log_rcv_thread.Start(0, std::bind(&CLoggingReceiveThread::ThreadFun, this), Thread::thread_class_monitoring, "ecal_mon_log");
     m_msg_buffer.resize(MSG_BUFFER_SIZE);
   }
 
@@ -96,6 +96,21 @@ namespace eCAL
     size_t recv_len = m_log_rcv.Receive(m_msg_buffer.data(), m_msg_buffer.size(), 10);
     if (recv_len > 0)
     {
+      // batched log messages (eCAL::pb::Logging)
+      m_log_ecal_batch.Clear();
+      if (m_log_ecal_batch.ParseFromArray(m_msg_buffer.data(), static_cast<int>(recv_len)) && (m_log_ecal_batch.logs_size() > 0))
+      {
+        for (const auto& log_msg : m_log_ecal_batch.logs())
+        {
+          if (IsLocalHost(log_msg) || m_network_mode)
+          {
+            m_log_cb(log_msg);
+          }
+        }
+        return(0);
+      }
+
+      // single log message (eCAL::pb::LogMessage, sent by older eCAL versions)
       m_log_ecal_msg.Clear();
       if (m_log_ecal_msg.ParseFromArray(m_msg_buffer.data(), static_cast<int>(recv_len)))
       {
@@ -112,7 +127,7 @@ namespace eCAL
   CMonLogPublishingThread::CMonLogPublishingThread(MonitoringCallbackT mon_cb_, LoggingCallbackT log_cb_) :
     m_mon_cb(mon_cb_), m_log_cb(log_cb_)
   {
-    m_pub_thread.Start(CMN_REGISTRATION_REFRESH, std::bind(&CMonLogPublishingThread::ThreadFun, this));
+    m_pub_thread.Start(CMN_REGISTRATION_REFRESH, std::bind(&CMonLogPublishingThread::ThreadFun, this), Thread::thread_class_monitoring, "ecal_mon_pub");
   };
 
   CMonLogPublishingThread::~CMonLogPublishingThread()
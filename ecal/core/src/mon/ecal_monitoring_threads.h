@@ -78,6 +78,7 @@ namespace eCAL
     bool                 m_network_mode;
     std::vector<char>    m_msg_buffer;
     eCAL::pb::LogMessage   m_log_ecal_msg;
+    eCAL::pb::Logging      m_log_ecal_batch;
     LogMessageCallbackT  m_log_cb;
   };
 
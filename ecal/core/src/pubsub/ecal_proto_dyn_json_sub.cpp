@@ -28,6 +28,9 @@
 #include <iostream>
 #include <sstream>
 #include <fstream>
+#include <map>
+#include <memory>
+#include <mutex>
 
 #ifdef ECAL_OS_WINDOWS
 #pragma warning(push)
@@ -37,9 +40,8 @@
 #pragma GCC diagnostic push
 #pragma GCC diagnostic ignored "-Wunused-parameter"
 #endif
+#include <google/protobuf/arena.h>
 #include <google/protobuf/util/json_util.h>
-#include <google/protobuf/util/type_resolver_util.h>
-#include <google/protobuf/util/type_resolver.h>
 #ifdef ECAL_OS_WINDOWS
 #pragma warning(pop)
 #endif
@@ -51,20 +53,59 @@ namespace eCAL
 {
   namespace protobuf
   {
+    /**
+     * @brief  Decoded message type, shared by all json subscribers of the same topic type.
+    **/
+    struct SDynamicMessageType
+    {
+      SDynamicMessageType() : prototype(nullptr) {};
+      CProtoDynDecoder                  decoder;
+      const google::protobuf::Message*  prototype;
+    };
+    typedef std::shared_ptr<SDynamicMessageType> DynamicMessageTypeT;
+
+    static std::mutex                                  g_dyn_msg_type_sync;
+    static std::map<std::string, DynamicMessageTypeT>  g_dyn_msg_type_map;
+
+    static DynamicMessageTypeT GetDynamicMessageType(const std::string& topic_type_, const std::string& topic_desc_, std::string& error_s_)
+    {
+      // type descriptors are built only once per topic type and description
+      std::lock_guard<std::mutex> lock(g_dyn_msg_type_sync);
+      const std::string key = topic_type_ + '\0' + topic_desc_;
+      auto iter = g_dyn_msg_type_map.find(key);
+      if (iter != g_dyn_msg_type_map.end()) return(iter->second);
+
+      google::protobuf::FileDescriptorSet proto_desc;
+      if (!proto_desc.ParseFromString(topic_desc_))
+      {
+        error_s_ = "could not parse description";
+        return(nullptr);
+      }
+
+      DynamicMessageTypeT msg_type = std::make_shared<SDynamicMessageType>();
+      std::unique_ptr<google::protobuf::Message> msg(msg_type->decoder.GetProtoMessageFromDescriptorSet(proto_desc, topic_type_, error_s_));
+      if (!msg) return(nullptr);
+      msg_type->prototype = msg->GetReflection()->GetMessageFactory()->GetPrototype(msg->GetDescriptor());
+
+      g_dyn_msg_type_map[key] = msg_type;
+      return(msg_type);
+    }
+
     class CDynamicJSONSubscriberImpl
     {
     public:
       CDynamicJSONSubscriberImpl() :
         created(false),
-        msg_decoder(nullptr),
-        msg_ptr()
-      {}
+        msg(nullptr)
+      {
+        json_options.always_print_primitive_fields = true;
+      }
 
       CDynamicJSONSubscriberImpl(const std::string& topic_name_) :
         created(false),
-        msg_decoder(nullptr),
-        msg_ptr()
+        msg(nullptr)
       {
+        json_options.always_print_primitive_fields = true;
         Create(topic_name_);
       }
 
@@ -77,9 +118,6 @@ namespace eCAL
       {
         if (created) return;
 
-        // create message decoder
-        msg_decoder = new eCAL::protobuf::CProtoDynDecoder();
-
         // create subscriber
         msg_sub.Create(topic_name_);
 
@@ -99,8 +137,10 @@ namespace eCAL
         // destroy subscriber
         msg_sub.Destroy();
 
-        // delete message decoder
-        delete msg_decoder;
+        // release message (owned by the arena)
+        msg = nullptr;
+        msg_arena.Reset();
+        msg_type.reset();
 
         created = false;
       }
@@ -116,72 +156,69 @@ namespace eCAL
       }
 
     protected:
-      void OnReceive(const char* topic_name_, const struct eCAL::SReceiveCallbackData* data_)
+      bool CreateMessage(const char* topic_name_)
       {
-        if (msg_ptr.empty())
+        // get topic type
+        std::string topic_type = eCAL::Util::GetTypeName(topic_name_);
+        topic_type = topic_type.substr(topic_type.find_first_of(':') + 1, topic_type.size());
+        topic_type = topic_type.substr(topic_type.find_last_of('.') + 1, topic_type.size());
+
+        if (topic_type.empty())
         {
-          // get topic type
-          topic_type_full = eCAL::Util::GetTypeName(topic_name_);
-          topic_type_full = topic_type_full.substr(topic_type_full.find_first_of(':') + 1, topic_type_full.size());
-          topic_type = topic_type_full.substr(topic_type_full.find_last_of('.') + 1, topic_type_full.size());
-          topic_type_full = "/" + topic_type_full;
-
-          if (topic_type.empty())
-          {
-            std::cout << "could not get type for topic " << topic_name_ << std::endl;
-            return;
-          }
-
-          // get topic description
-          topic_desc = eCAL::Util::GetDescription(topic_name_);
-          if (topic_desc.empty())
-          {
-            std::cout << "could not get description for topic " << topic_name_ << std::endl;
-            return;
-          }
-
-          std::string error_s;
-          google::protobuf::FileDescriptorSet proto_desc;
-          proto_desc.ParseFromString(topic_desc);
-          msg_decoder->GetProtoMessageFromDescriptorSet(proto_desc, topic_type, error_s);
-          resolver_.reset(google::protobuf::util::NewTypeResolverForDescriptorPool("", msg_decoder->GetDescriptorPool()));
+          std::cout << "could not get type for topic " << topic_name_ << std::endl;
+          return(false);
         }
 
-        // decode message and execute callback
-        //if(msg_callback && msg_ptr && msg_ptr->ParseFromArray(data_->buf, data_->size))
-        if (msg_callback)
+        // get topic description
+        std::string topic_desc = eCAL::Util::GetDescription(topic_name_);
+        if (topic_desc.empty())
         {
+          std::cout << "could not get description for topic " << topic_name_ << std::endl;
+          return(false);
+        }
 
-          google::protobuf::util::JsonOptions options;
-          options.always_print_primitive_fields = true;
-
-          std::string binary_input;
-          binary_input.assign((char*)data_->buf, static_cast<size_t>(data_->size));
-          msg_ptr.clear();
-          auto status = google::protobuf::util::BinaryToJsonString(resolver_.get(), topic_type_full, binary_input, &msg_ptr, options);
-          if (status == google::protobuf::util::Status::OK)
-          {
-            SReceiveCallbackData cb_data;
-            cb_data.buf = (void*)msg_ptr.c_str();
-            cb_data.size = (long)msg_ptr.size();
-            cb_data.time = data_->time;
-            msg_callback(topic_name_, &cb_data);
-          }
+        std::string error_s;
+        msg_type = GetDynamicMessageType(topic_type, topic_desc, error_s);
+        if (!msg_type)
+        {
+          std::cout << "could not decode type for topic " << topic_name_ << " : " << error_s << std::endl;
+          return(false);
         }
+
+        // one arena allocated message is reused for all receives
+        msg = msg_type->prototype->New(&msg_arena);
+        return(msg != nullptr);
       }
 
-      bool                              created;
-      eCAL::protobuf::CProtoDynDecoder* msg_decoder;
-      std::string                       msg_ptr;
-      eCAL::CSubscriber                 msg_sub;
-      ReceiveCallbackT                  msg_callback;
+      void OnReceive(const char* topic_name_, const struct eCAL::SReceiveCallbackData* data_)
+      {
+        if (!msg_callback) return;
+        if ((msg == nullptr) && !CreateMessage(topic_name_)) return;
+
+        // decode message and execute callback
+        if (!msg->ParseFromArray(data_->buf, static_cast<int>(data_->size))) return;
+
+        json.clear();
+        auto status = google::protobuf::util::MessageToJsonString(*msg, &json, json_options);
+        if (status.ok())
+        {
+          SReceiveCallbackData cb_data;
+          cb_data.buf  = (void*)json.c_str();
+          cb_data.size = (long)json.size();
+          cb_data.time = data_->time;
+          msg_callback(topic_name_, &cb_data);
+        }
+      }
 
-      std::string topic_type;
-      std::string topic_type_full;
+      bool                                   created;
+      eCAL::CSubscriber                      msg_sub;
+      ReceiveCallbackT                       msg_callback;
 
-      std::string topic_desc;
-      std::shared_ptr<google::protobuf::util::TypeResolver> resolver_;
-      google::protobuf::DescriptorPool m_descriptor_pool;
+      DynamicMessageTypeT                    msg_type;
+      google::protobuf::Arena                msg_arena;
+      google::protobuf::Message*             msg;
+      google::protobuf::util::JsonOptions    json_options;
+      std::string                            json;
 
     private:
       // this object must not be copied.
@@ -122,9 +122,13 @@ namespace eCAL
     std::string topic_name = ecal_sample_topic.tname();
     std::string process_id = std::to_string(ecal_sample_topic.pid());
     std::string reader_par;
+    std::string udp_par;
+    std::string shm_par;
     for (auto layer : ecal_sample_topic.tlayer())
     {
       reader_par = layer.par();
+      if (layer.type() == eCAL::pb::tl_ecal_udp_mc) udp_par = layer.par();
+      if (layer.type() == eCAL::pb::tl_ecal_shm)    shm_par = layer.par();
     }
 
     // store description
@@ -140,7 +144,7 @@ namespace eCAL
     auto res = m_topic_name_datawriter_map.equal_range(topic_name);
     for(TopicNameDataWriterMapT::const_iterator iter = res.first; iter != res.second; ++iter)
     {
-      iter->second->ApplyLocSubscription(process_id, reader_par);
+      iter->second->ApplyLocSubscription(process_id, reader_par, udp_par, shm_par);
     }
   }
 
@@ -153,9 +157,11 @@ namespace eCAL
     std::string topic_name = ecal_sample_topic.tname();
     std::string process_id = std::to_string(ecal_sample_topic.pid());
     std::string reader_par;
+    std::string udp_par;
     for (auto layer : ecal_sample_topic.tlayer())
     {
       reader_par = layer.par();
+      if (layer.type() == eCAL::pb::tl_ecal_udp_mc) udp_par = layer.par();
     }
 
     // store description
@@ -171,7 +177,7 @@ namespace eCAL
     auto res = m_topic_name_datawriter_map.equal_range(topic_name);
     for(TopicNameDataWriterMapT::const_iterator iter = res.first; iter != res.second; ++iter)
     {
-      iter->second->ApplyExtSubscription(host_name, process_id, reader_par);
+      iter->second->ApplyExtSubscription(host_name, process_id, reader_par, udp_par);
     }
   }
 
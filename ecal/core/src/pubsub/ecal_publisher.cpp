@@ -242,6 +242,13 @@ namespace eCAL
       m_tlayer.sm_shm = mode_;
       break;
     case TLayer::tlayer_lcm:
+#ifndef ECAL_LAYER_LCM
+      if (mode_ != TLayer::smode_off)
+      {
+        if (g_log()) g_log()->Log(log_level_warning, "CPublisher::SetLayerMode - lcm layer not available in this build");
+        return false;
+      }
+#endif /* ECAL_LAYER_LCM */
       m_tlayer.sm_lcm = mode_;
       break;
     case TLayer::tlayer_rtps:
@@ -280,6 +287,24 @@ namespace eCAL
     return m_datawriter->SetMaxBandwidthUDP(bandwidth_);
   }
 
+  bool CPublisher::SetBatching(size_t max_messages_, size_t max_bytes_, int max_delay_ms_)
+  {
+    if (!m_created) return(false);
+    return m_datawriter->SetBatching(max_messages_, max_bytes_, max_delay_ms_);
+  }
+
+  bool CPublisher::SetCompressionUDP(TLayer::eCompression compression_)
+  {
+    if (!m_created) return(false);
+    return m_datawriter->SetCompressionUDP(compression_);
+  }
+
+  size_t CPublisher::Flush() const
+  {
+    if (!m_created) return(0);
+    return(m_datawriter->Flush());
+  }
+
   bool CPublisher::SetID(long long id_)
   {
     m_id = id_;
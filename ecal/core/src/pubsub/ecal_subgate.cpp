@@ -32,6 +32,8 @@
 #include "ecal_descgate.h"
 
 #include "pubsub/ecal_subgate.h"
+#include "ecal_trace.h"
+#include "readwrite/ecal_compression.h"
 
 ////////////////////////////////////////////////////////
 // local events
@@ -74,7 +76,7 @@ namespace eCAL
     CDataReader::InitializeLayers();
 
     // start timeout thread
-    m_subtimeout_thread.Start(CMN_DATAREADER_TIMEOUT_DTIME, std::bind(&CSubGate::CheckTimeouts, this));
+    m_subtimeout_thread.Start(CMN_DATAREADER_TIMEOUT_DTIME, std::bind(&CSubGate::CheckTimeouts, this), Thread::thread_class_timeout, "ecal_sub_to");
     m_created = true;
   }
 
@@ -134,6 +136,7 @@ namespace eCAL
   size_t CSubGate::ApplySample(const eCAL::pb::Sample& ecal_sample_, eCAL::pb::eTLayerType layer_)
   {
     if(!m_created) return 0;
+    ECAL_TRACE_SCOPE(probe_subgate_dispatch, layer_);
 
     size_t sent(0);
     switch (ecal_sample_.cmd_type())
@@ -151,10 +154,25 @@ namespace eCAL
 
       // update globals
       g_process_rclock++;
-      auto ecal_sample_content = ecal_sample_.content();
-      auto ecal_sample_content_payload = ecal_sample_content.payload();
+      const auto& ecal_sample_content = ecal_sample_.content();
+      const auto& ecal_sample_content_payload = ecal_sample_content.payload();
       g_process_rbytes_sum += ecal_sample_content_payload.size();
 
+      // decompress network payload once for all data readers
+      const char* payload_buf  = ecal_sample_content_payload.data();
+      size_t      payload_size = ecal_sample_content_payload.size();
+      if (ecal_sample_content.compression() != TLayer::compression_none)
+      {
+        static thread_local std::vector<char> decompression_buf;
+        if (!Compression::Decompress(TLayer::eCompression(ecal_sample_content.compression()), payload_buf, payload_size, static_cast<size_t>(ecal_sample_content.raw_size()), decompression_buf))
+        {
+          eCAL::Logging::Log(log_level_error, ecal_sample_.topic().tname() + " : failed to decompress payload !");
+          return 0;
+        }
+        payload_buf  = decompression_buf.data();
+        payload_size = decompression_buf.size();
+      }
+
       // add sample to data reader
       std::lock_guard<std::mutex> lock(m_topic_name_datareader_sync);
       auto res = m_topic_name_datareader_map.equal_range(ecal_sample_.topic().tname());
@@ -162,13 +180,14 @@ namespace eCAL
       {
         sent = it->second->AddSample(
           ecal_sample_.topic().tid(),
-          ecal_sample_content_payload.data(),
-          ecal_sample_content_payload.size(),
+          payload_buf,
+          payload_size,
           ecal_sample_content.id(),
           ecal_sample_content.clock(),
           ecal_sample_content.time(),
           static_cast<size_t>(ecal_sample_content.hash()),
-          layer_
+          layer_,
+          ecal_sample_content.batch()
         );
       }
     }
@@ -180,9 +199,10 @@ namespace eCAL
     return sent;
   }
 
-  size_t CSubGate::ApplySample(const std::string& topic_name_, const std::string& topic_id_, const char* buf_, size_t len_, long long id_, long long clock_, long long time_, size_t hash_, eCAL::pb::eTLayerType layer_)
+  size_t CSubGate::ApplySample(const std::string& topic_name_, const std::string& topic_id_, const char* buf_, size_t len_, long long id_, long long clock_, long long time_, size_t hash_, eCAL::pb::eTLayerType layer_, bool batch_)
   {
     if(!m_created) return 0;
+    ECAL_TRACE_SCOPE(probe_subgate_dispatch, layer_);
 
     // update globals
     g_process_rclock++;
@@ -194,7 +214,7 @@ namespace eCAL
     auto res = m_topic_name_datareader_map.equal_range(topic_name_);
     for (auto it = res.first; it != res.second; ++it)
     {
-      sent = it->second->AddSample(topic_id_, buf_, len_, id_, clock_, time_, hash_, layer_);
+      sent = it->second->AddSample(topic_id_, buf_, len_, id_, clock_, time_, hash_, layer_, batch_);
     }
 
     return sent;
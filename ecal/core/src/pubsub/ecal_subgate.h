@@ -48,7 +48,7 @@ namespace eCAL
 
     bool HasSample(const std::string& sample_name_);
     size_t ApplySample(const eCAL::pb::Sample& ecal_sample_, eCAL::pb::eTLayerType layer_);
-    size_t ApplySample(const std::string& topic_name_, const std::string& topic_id_, const char* buf_, size_t len_, long long id_, long long clock_, long long time_, size_t hash_, eCAL::pb::eTLayerType layer_);
+    size_t ApplySample(const std::string& topic_name_, const std::string& topic_id_, const char* buf_, size_t len_, long long id_, long long clock_, long long time_, size_t hash_, eCAL::pb::eTLayerType layer_, bool batch_);
 
     void ApplyLocPubRegistration(const eCAL::pb::Sample& ecal_sample_);
     void ApplyExtPubRegistration(const eCAL::pb::Sample& ecal_sample_);
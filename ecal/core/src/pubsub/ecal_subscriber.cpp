@@ -190,6 +190,12 @@ namespace eCAL
     return(m_datareader->Receive(buf_, time_, rcv_timeout_));
   }
 
+  bool CSubscriber::ReceiveInPlace(const ReceiveBufferT& consumer_, long long* time_ /* = nullptr */, int rcv_timeout_ /* = 0 */) const
+  {
+    if(!m_created) return(false);
+    return(m_datareader->Receive(consumer_, time_, rcv_timeout_));
+  }
+
   bool CSubscriber::AddReceiveCallback(ReceiveCallbackT callback_)
   {
     if(!m_datareader) return(false);
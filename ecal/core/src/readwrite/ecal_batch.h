@@ -0,0 +1,113 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright (C) 2016 - 2019 Continental Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+
+/**
+ * @brief  eCAL publisher sample batch frame
+**/
+
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+namespace eCAL
+{
+  /**
+  * @brief Header of every sample in a batch frame, directly followed by the sample payload.
+  *
+  * A batch frame is sent like a single sample with the batch flag set
+  * (SEcalMessage::batch for shared memory, Content::batch for udp).
+  **/
+  struct SBatchSampleHeader
+  {
+    uint64_t  size;
+    uint64_t  id;
+    uint64_t  clock;
+    int64_t   time;
+  };
+
+  /**
+  * @brief  hash of a sample of a publisher topic (discards samples received on several layers)
+  **/
+  inline size_t SampleHash(size_t topic_hash_, long long clock_)
+  {
+    return(topic_hash_ ^ (static_cast<size_t>(clock_) << 1));
+  }
+
+  /**
+  * @brief  hash of a batch frame, the flipped lowest bit keeps frames apart
+  *         from the single sample that was sent with the same clock
+  **/
+  inline size_t BatchFrameHash(size_t topic_hash_, long long clock_)
+  {
+    return(SampleHash(topic_hash_, clock_) ^ 1);
+  }
+
+  /**
+  * @brief  hash a sample of a batch frame gets when it is sent on its own
+  *         (lcm and rtps send batched samples one by one)
+  **/
+  inline size_t BatchSampleHash(size_t frame_hash_, long long frame_clock_, long long sample_clock_)
+  {
+    const size_t topic_hash = frame_hash_ ^ 1 ^ (static_cast<size_t>(frame_clock_) << 1);
+    return(SampleHash(topic_hash, sample_clock_));
+  }
+
+  /**
+  * @brief  append a sample to a batch frame
+  **/
+  inline void AppendBatchSample(std::vector<char>& batch_, const void* buf_, size_t len_, long long id_, long long clock_, long long time_)
+  {
+    SBatchSampleHeader header;
+    header.size  = static_cast<uint64_t>(len_);
+    header.id    = static_cast<uint64_t>(id_);
+    header.clock = static_cast<uint64_t>(clock_);
+    header.time  = static_cast<int64_t>(time_);
+
+    const size_t offset = batch_.size();
+    batch_.resize(offset + sizeof(header) + len_);
+    memcpy(&batch_[offset], &header, sizeof(header));
+    if (len_ > 0) memcpy(&batch_[offset + sizeof(header)], buf_, len_);
+  }
+
+  /**
+  * @brief  call fn_(buf, len, id, clock, time) for every sample of a batch frame
+  *
+  * @return  false if the frame is truncated or malformed
+  **/
+  template <typename F>
+  inline bool ForEachBatchSample(const char* batch_, size_t len_, F fn_)
+  {
+    size_t offset(0);
+    while (offset < len_)
+    {
+      if (len_ - offset < sizeof(SBatchSampleHeader)) return(false);
+      SBatchSampleHeader header;
+      memcpy(&header, batch_ + offset, sizeof(header));
+      offset += sizeof(header);
+
+      if (header.size > len_ - offset) return(false);
+      fn_(batch_ + offset, static_cast<size_t>(header.size), static_cast<long long>(header.id), static_cast<long long>(header.clock), static_cast<long long>(header.time));
+      offset += static_cast<size_t>(header.size);
+    }
+    return(true);
+  }
+}
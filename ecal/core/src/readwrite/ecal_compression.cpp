@@ -0,0 +1,134 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright (C) 2016 - 2019 Continental Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+
+/**
+ * @brief  eCAL network layer payload compression
+**/
+
+#include "readwrite/ecal_compression.h"
+
+#include <sstream>
+
+#ifdef ECAL_LAYER_UDP_COMPRESSION
+#include <lz4.h>
+#endif /* ECAL_LAYER_UDP_COMPRESSION */
+
+namespace eCAL
+{
+  namespace Compression
+  {
+    bool IsAvailable(TLayer::eCompression codec_)
+    {
+      switch (codec_)
+      {
+#ifdef ECAL_LAYER_UDP_COMPRESSION
+      case TLayer::compression_lz4:
+        return true;
+#endif /* ECAL_LAYER_UDP_COMPRESSION */
+      default:
+        return false;
+      }
+    }
+
+    std::string GetName(TLayer::eCompression codec_)
+    {
+      switch (codec_)
+      {
+      case TLayer::compression_lz4:
+        return "lz4";
+      default:
+        return "";
+      }
+    }
+
+    std::string GetAvailableNames()
+    {
+      std::string names;
+      if (IsAvailable(TLayer::compression_lz4)) names += GetName(TLayer::compression_lz4);
+      return(names);
+    }
+
+    bool HasCodec(const std::string& layer_par_, TLayer::eCompression codec_)
+    {
+      const std::string name = GetName(codec_);
+      if (name.empty()) return false;
+
+      std::stringstream par(layer_par_);
+      std::string item;
+      while (std::getline(par, item, ','))
+      {
+        if (item == name) return true;
+      }
+      return false;
+    }
+
+    bool Compress(TLayer::eCompression codec_, const void* buf_, size_t len_, std::vector<char>& out_)
+    {
+      switch (codec_)
+      {
+#ifdef ECAL_LAYER_UDP_COMPRESSION
+      case TLayer::compression_lz4:
+      {
+        if (len_ > static_cast<size_t>(LZ4_MAX_INPUT_SIZE)) return false;
+        const int src_size = static_cast<int>(len_);
+        // only worth sending if we save something
+        const int dst_size = src_size - 1;
+        if (dst_size <= 0) return false;
+        if (out_.size() < static_cast<size_t>(LZ4_compressBound(src_size))) out_.resize(LZ4_compressBound(src_size));
+        const int written = LZ4_compress_default(static_cast<const char*>(buf_), out_.data(), src_size, dst_size);
+        if (written <= 0) return false;
+        out_.resize(static_cast<size_t>(written));
+        return true;
+      }
+#endif /* ECAL_LAYER_UDP_COMPRESSION */
+      default:
+        (void)buf_;
+        (void)len_;
+        (void)out_;
+        return false;
+      }
+    }
+
+    bool Decompress(TLayer::eCompression codec_, const void* buf_, size_t len_, size_t raw_len_, std::vector<char>& out_)
+    {
+      switch (codec_)
+      {
+#ifdef ECAL_LAYER_UDP_COMPRESSION
+      case TLayer::compression_lz4:
+      {
+        if (len_ > static_cast<size_t>(LZ4_MAX_INPUT_SIZE) || raw_len_ > static_cast<size_t>(LZ4_MAX_INPUT_SIZE)) return false;
+        // the raw size comes from the network, lz4 can not expand more than
+        // 255 times, so do not allocate more than that for a bogus size
+        if (raw_len_ > len_ * 255 + 16) return false;
+        out_.resize(raw_len_);
+        const int read = LZ4_decompress_safe(static_cast<const char*>(buf_), out_.data(), static_cast<int>(len_), static_cast<int>(raw_len_));
+        return(read == static_cast<int>(raw_len_));
+      }
+#endif /* ECAL_LAYER_UDP_COMPRESSION */
+      default:
+        (void)buf_;
+        (void)len_;
+        (void)raw_len_;
+        (void)out_;
+        return false;
+      }
+    }
+  }
+}
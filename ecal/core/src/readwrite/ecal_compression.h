@@ -0,0 +1,67 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright (C) 2016 - 2019 Continental Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+
+/**
+ * @brief  eCAL network layer payload compression
+**/
+
+#pragma once
+
+#include <ecal/ecal_tlayer.h>
+
+#include <string>
+#include <vector>
+
+namespace eCAL
+{
+  namespace Compression
+  {
+    /**
+    * @brief  check if the codec is supported by this build
+    **/
+    bool IsAvailable(TLayer::eCompression codec_);
+
+    /**
+    * @brief  name of the codec used in the udp layer parameter ("" for none)
+    **/
+    std::string GetName(TLayer::eCompression codec_);
+
+    /**
+    * @brief  comma separated list of all codecs this build can decompress (reader layer parameter)
+    **/
+    std::string GetAvailableNames();
+
+    /**
+    * @brief  check if a (reader) layer parameter lists the codec
+    **/
+    bool HasCodec(const std::string& layer_par_, TLayer::eCompression codec_);
+
+    /**
+    * @brief  compress buffer into out_, returns false if the codec is not available or the result would not be smaller
+    **/
+    bool Compress(TLayer::eCompression codec_, const void* buf_, size_t len_, std::vector<char>& out_);
+
+    /**
+    * @brief  decompress buffer into out_ (resized to raw_len_), returns false on corrupted data
+    *         or a raw size the codec can not produce from len_ bytes
+    **/
+    bool Decompress(TLayer::eCompression codec_, const void* buf_, size_t len_, size_t raw_len_, std::vector<char>& out_);
+  }
+}
@@ -27,12 +27,18 @@
 #include "ecal_register.h"
 #include "ecal_descgate.h"
 #include "ecal_reader.h"
+#include "ecal_trace.h"
+
+#include "readwrite/ecal_batch.h"
+#include "readwrite/ecal_compression.h"
 
 #include "readwrite/ecal_reader_udp_mc.h"
 #include "readwrite/ecal_reader_udp_uc.h"
 #include "readwrite/ecal_reader_shm.h"
 #include "readwrite/ecal_reader_metal.h"
+#ifdef ECAL_LAYER_LCM
 #include "readwrite/ecal_reader_lcm.h"
+#endif /* ECAL_LAYER_LCM */
 #ifdef ECAL_LAYER_FASTRTPS
 #include "readwrite/ecal_reader_rtps.h"
 #endif /* ECAL_LAYER_FASTRTPS */
@@ -47,6 +53,37 @@
 
 namespace eCAL
 {
+  // transport layers with separate receive statistics
+  static const eCAL::pb::eTLayerType g_stats_layer[] =
+  {
+    eCAL::pb::tl_ecal_udp_mc,
+    eCAL::pb::tl_ecal_udp_uc,
+    eCAL::pb::tl_ecal_udp_metal,
+    eCAL::pb::tl_ecal_shm,
+    eCAL::pb::tl_lcm,
+    eCAL::pb::tl_rtps,
+    eCAL::pb::tl_inproc
+  };
+
+  static void SetHistogramMsg(const Util::CHistogram& histogram_, eCAL::pb::Histogram* pb_histogram_)
+  {
+    pb_histogram_->set_count(histogram_.Count());
+    pb_histogram_->set_min(histogram_.Min());
+    pb_histogram_->set_max(histogram_.Max());
+    pb_histogram_->set_mean(histogram_.Mean());
+    pb_histogram_->set_p50(histogram_.Percentile(0.5));
+    pb_histogram_->set_p90(histogram_.Percentile(0.9));
+    pb_histogram_->set_p99(histogram_.Percentile(0.99));
+    pb_histogram_->set_p999(histogram_.Percentile(0.999));
+    for (int i = 0; i < Util::CHistogram::bucket_count; ++i)
+    {
+      const long long cnt = histogram_.BucketCount(i);
+      if (cnt == 0) continue;
+      pb_histogram_->add_bucket_bound(Util::CHistogram::BucketUpperBound(i));
+      pb_histogram_->add_bucket_count(cnt);
+    }
+  }
+
   ////////////////////////////////////////
   // CDataReader
   ////////////////////////////////////////
@@ -60,7 +97,8 @@ namespace eCAL
                  m_mcast_address(""),
                  m_topic_size(0),
                  m_connected(false),
-                 m_read_time(0),
+                 m_read_queue_head(0),
+                 m_read_queue_count(0),
                  m_receive_timeout(0),
                  m_receive_time(0),
                  m_clock(0),
@@ -80,16 +118,27 @@ namespace eCAL
                  m_use_udp_uc_confirmed(false),
                  m_use_udp_metal_confirmed(false),
                  m_use_shm_confirmed(false),
+#ifdef ECAL_LAYER_LCM
                  m_use_lcm_confirmed(false),
+#endif /* ECAL_LAYER_LCM */
                  m_use_rtps_confirmed(false),
                  m_use_inproc_confirmed(false),
                  m_created(false)
   {
+    for (auto& stats : m_layer_stats)
+    {
+      stats.store(nullptr);
+    }
   }
 
   CDataReader::~CDataReader()
   {
     Destroy();
+
+    for (auto& stats : m_layer_stats)
+    {
+      delete stats.exchange(nullptr);
+    }
   }
 
   bool CDataReader::Create(const std::string& topic_name_, const std::string& topic_type_, const std::string& topic_desc_)
@@ -124,13 +173,31 @@ namespace eCAL
     // create receive event
     gOpenEvent(&m_receive_event);
 
+    // create receive queue, sized by the configured depth (or the qos history depth)
+    {
+      std::lock_guard<std::mutex> lock(m_read_buf_sync);
+      int depth_par = eCALPAR(SUB, RECEIVE_QUEUE_DEPTH);
+      if (depth_par <= 0) depth_par = m_qos.history_kind_depth;
+      const size_t depth = depth_par > 0 ? static_cast<size_t>(depth_par) : 1;
+      m_read_queue.clear();
+      m_read_queue.resize(depth);
+      m_read_queue_head  = 0;
+      m_read_queue_count = 0;
+    }
+
+    // create callback dispatch queue (if dispatching is enabled)
+    if (g_reader_dispatcher())
+    {
+      m_dispatch_queue = g_reader_dispatcher()->CreateQueue(std::bind(&CDataReader::DispatchSample, this, std::placeholders::_1));
+    }
+
     // set registration expiration
     std::chrono::milliseconds registration_timeout(eCALPAR(CMN, REGISTRATION_TO));
     m_loc_pub_map.set_expiration(registration_timeout);
     m_ext_pub_map.set_expiration(registration_timeout);
 
-    // set sample hash map expiration
-    m_sample_hash.set_expiration(std::chrono::milliseconds(500));
+    // forget samples of a previous session
+    m_sample_hash.clear();
 
     // allow to share topic type
     m_use_ttype = eCALPAR(PUB, SHARE_TTYPE) != 0;
@@ -168,6 +235,17 @@ namespace eCAL
       m_receive_callback = nullptr;
     }
 
+    // stop callback dispatching
+    if (m_dispatch_queue)
+    {
+      m_dispatch_queue->Close();
+      m_dispatch_queue = nullptr;
+    }
+    {
+      std::lock_guard<std::mutex> lock(m_dispatch_callback_sync);
+      m_dispatch_callback = nullptr;
+    }
+
     // reset event callback
     {
       std::lock_guard<std::mutex> lock(m_event_callback_sync);
@@ -177,6 +255,14 @@ namespace eCAL
     // destroy receive event
     gCloseEvent(m_receive_event);
 
+    // clear receive queue
+    {
+      std::lock_guard<std::mutex> lock(m_read_buf_sync);
+      m_read_queue.clear();
+      m_read_queue_head  = 0;
+      m_read_queue_count = 0;
+    }
+
     // reset defaults
     m_created                 = false;
     m_clock                   = 0;
@@ -193,7 +279,9 @@ namespace eCAL
     m_use_udp_uc_confirmed    = false;
     m_use_udp_metal_confirmed = false;
     m_use_shm_confirmed       = false;
+#ifdef ECAL_LAYER_LCM
     m_use_lcm_confirmed       = false;
+#endif /* ECAL_LAYER_LCM */
     m_use_rtps_confirmed      = false;
     m_use_inproc_confirmed    = false;
 
@@ -226,11 +314,13 @@ namespace eCAL
       CMetalLayer::Get()->InitializeLayer();
     }
 
+#ifdef ECAL_LAYER_LCM
     // start udp lcm layer
     if (eCALPAR(NET, LCM_REC_ENABLED))
     {
       CLcmLayer::Get()->InitializeLayer();
     }
+#endif /* ECAL_LAYER_LCM */
 
 #ifdef ECAL_LAYER_FASTRTPS
     // start rtps layer
@@ -252,45 +342,47 @@ namespace eCAL
     // start ecal udp multicast layer
     if (eCALPAR(NET, UDP_MC_REC_ENABLED))
     {
-      CMulticastLayer::Get()->StartLayer(m_topic_name, m_qos);
+      CMulticastLayer::Get()->StartLayer(m_topic_name, m_topic_id, m_qos);
     }
 
     // start ecal udp unicast layer
     if (eCALPAR(NET, UDP_UC_REC_ENABLED))
     {
-      CUnicastLayer::Get()->StartLayer(m_topic_name, m_qos);
+      CUnicastLayer::Get()->StartLayer(m_topic_name, m_topic_id, m_qos);
     }
 
     // start ecal shared memory layer
     if (eCALPAR(NET, SHM_REC_ENABLED))
     {
-      CSHMLayer::Get()->StartLayer(m_topic_name, m_qos);
+      CSHMLayer::Get()->StartLayer(m_topic_name, m_topic_id, m_qos);
     }
 
     // start ecal udp metal layer
     if (eCALPAR(NET, METAL_REC_ENABLED))
     {
-      CMetalLayer::Get()->StartLayer(m_topic_name, m_qos);
+      CMetalLayer::Get()->StartLayer(m_topic_name, m_topic_id, m_qos);
     }
 
+#ifdef ECAL_LAYER_LCM
     // start udp lcm layer
     if (eCALPAR(NET, LCM_REC_ENABLED))
     {
-      CLcmLayer::Get()->StartLayer(m_topic_name, m_qos);
+      CLcmLayer::Get()->StartLayer(m_topic_name, m_topic_id, m_qos);
     }
+#endif /* ECAL_LAYER_LCM */
 
 #ifdef ECAL_LAYER_FASTRTPS
     // start rtps layer
     if (eCALPAR(NET, RTPS_REC_ENABLED))
     {
-      CRtpsLayer::Get()->StartLayer(m_topic_name, m_qos);
+      CRtpsLayer::Get()->StartLayer(m_topic_name, m_topic_id, m_qos);
     }
 #endif /*ECAL_LAYER_FASTRTPS*/
 
     // start inproc layer
     if (eCALPAR(NET, INPROC_REC_ENABLED))
     {
-      CInProcLayer::Get()->StartLayer(m_topic_name, m_qos);
+      CInProcLayer::Get()->StartLayer(m_topic_name, m_topic_id, m_qos);
     }
   }
   
@@ -299,45 +391,47 @@ namespace eCAL
     // stop ecal udp multicast layer
     if (eCALPAR(NET, UDP_MC_REC_ENABLED))
     {
-      CMulticastLayer::Get()->StopLayer(m_topic_name);
+      CMulticastLayer::Get()->StopLayer(m_topic_name, m_topic_id);
     }
 
     // stop ecal udp unicast layer
     if (eCALPAR(NET, UDP_UC_REC_ENABLED))
     {
-      CUnicastLayer::Get()->StopLayer(m_topic_name);
+      CUnicastLayer::Get()->StopLayer(m_topic_name, m_topic_id);
     }
 
     // stop ecal shared memory layer
     if (eCALPAR(NET, SHM_REC_ENABLED))
     {
-      CSHMLayer::Get()->StopLayer(m_topic_name);
+      CSHMLayer::Get()->StopLayer(m_topic_name, m_topic_id);
     }
 
     // stop ecal udp metal layer
     if (eCALPAR(NET, METAL_REC_ENABLED))
     {
-      CMetalLayer::Get()->StopLayer(m_topic_name);
+      CMetalLayer::Get()->StopLayer(m_topic_name, m_topic_id);
     }
 
+#ifdef ECAL_LAYER_LCM
     // stop udp lcm layer
     if (eCALPAR(NET, LCM_REC_ENABLED))
     {
-      CLcmLayer::Get()->StopLayer(m_topic_name);
+      CLcmLayer::Get()->StopLayer(m_topic_name, m_topic_id);
     }
+#endif /* ECAL_LAYER_LCM */
 
 #ifdef ECAL_LAYER_FASTRTPS
     // start rtps layer
     if (eCALPAR(NET, RTPS_REC_ENABLED))
     {
-      CRtpsLayer::Get()->StopLayer(m_topic_name);
+      CRtpsLayer::Get()->StopLayer(m_topic_name, m_topic_id);
     }
 #endif /*ECAL_LAYER_FASTRTPS*/
 
     // stop inproc layer
     if (eCALPAR(NET, INPROC_REC_ENABLED))
     {
-      CInProcLayer::Get()->StopLayer(m_topic_name);
+      CInProcLayer::Get()->StopLayer(m_topic_name, m_topic_id);
     }
   }
 
@@ -362,7 +456,7 @@ namespace eCAL
       tlayer->set_type(eCAL::pb::tl_ecal_udp_mc);
       tlayer->set_version(1);
       tlayer->set_confirmed(m_use_udp_mc_confirmed);
-      tlayer->set_par("");
+      tlayer->set_par(Compression::GetAvailableNames());
     }
     // udp unicast layer
     {
@@ -370,7 +464,7 @@ namespace eCAL
       tlayer->set_type(eCAL::pb::tl_ecal_udp_uc);
       tlayer->set_version(1);
       tlayer->set_confirmed(m_use_udp_uc_confirmed);
-      tlayer->set_par("");
+      tlayer->set_par(Compression::GetAvailableNames());
     }
     // shm layer
     {
@@ -378,8 +472,9 @@ namespace eCAL
       tlayer->set_type(eCAL::pb::tl_ecal_shm);
       tlayer->set_version(1);
       tlayer->set_confirmed(m_use_shm_confirmed);
-      tlayer->set_par("");
+      tlayer->set_par(PUB_MEMFILE_BC_READER_PAR);
     }
+#ifdef ECAL_LAYER_LCM
     // lcm layer
     {
       auto tlayer = ecal_reg_sample_mutable_topic->add_tlayer();
@@ -388,6 +483,7 @@ namespace eCAL
       tlayer->set_confirmed(m_use_lcm_confirmed);
       tlayer->set_par("");
     }
+#endif /* ECAL_LAYER_LCM */
     // rtps layer
     {
       auto tlayer = ecal_reg_sample_mutable_topic->add_tlayer();
@@ -414,6 +510,7 @@ namespace eCAL
     ecal_reg_sample_mutable_topic->set_dfreq_min_err(google::protobuf::int32(m_freq_min_err));
     ecal_reg_sample_mutable_topic->set_dfreq_max_err(google::protobuf::int32(m_freq_max_err));
     ecal_reg_sample_mutable_topic->set_message_drops(google::protobuf::int32(m_message_drops));
+    RegisterLayerStatistics(ecal_reg_sample_mutable_topic);
 
     size_t loc_connections(0);
     size_t ext_connections(0);
@@ -464,29 +561,52 @@ namespace eCAL
 
   size_t CDataReader::Receive(std::string& buf_, long long* time_ /* = nullptr */, int rcv_timeout_ /* = 0 */)
   {
-    if(!m_created) return(0);
+    // copy content to target string
+    auto copy = [&buf_](const void* buf, size_t size) { buf_.assign(static_cast<const char*>(buf), size); return(true); };
+    if(!Receive(copy, time_, rcv_timeout_)) return(0);
+
+    // return success
+    return(buf_.size());
+  }
 
-    // did we receive new samples ?
-    if(gWaitForEvent(m_receive_event, rcv_timeout_))
+  bool CDataReader::Receive(const ReceiveBufferT& consumer_, long long* time_ /* = nullptr */, int rcv_timeout_ /* = 0 */)
+  {
+    if(!m_created) return(false);
+
+    // wait for new samples if the receive queue is empty
+    bool available(false);
     {
+      std::lock_guard<std::mutex> lock(m_read_buf_sync);
+      available = m_read_queue_count > 0;
+    }
+    if(!available && !gWaitForEvent(m_receive_event, rcv_timeout_)) return(false);
+
 #ifndef NDEBUG
-      // log it
-      Logging::Log(log_level_debug3, m_topic_name + "::CDataReader::Receive");
+    // log it
+    Logging::Log(log_level_debug3, m_topic_name + "::CDataReader::Receive");
 #endif
-      // copy content to target string
-      std::lock_guard<std::mutex> lock(m_read_buf_sync);
-      buf_.clear();
-      buf_.assign(m_read_buf.data(), m_read_buf.size());
 
-      // apply time
-      if(time_) *time_ = m_read_time;
-      // return success
-      return(m_read_buf.size());
-    }
-    return(0);
+    // take the oldest sample from the receive queue
+    std::lock_guard<std::mutex> lock(m_read_buf_sync);
+    if(m_read_queue_count == 0) return(false);
+
+    // hand over content in place
+    const SReadSample& sample = m_read_queue[m_read_queue_head];
+    const bool consumed = consumer_(sample.buf.data(), sample.buf.size());
+
+    // apply time
+    if(time_) *time_ = sample.time;
+
+    m_read_queue_head = (m_read_queue_head + 1) % m_read_queue.size();
+    m_read_queue_count--;
+
+    // queue drained, consume the pending receive event
+    if(m_read_queue_count == 0) gWaitForEvent(m_receive_event, 0);
+
+    return(consumed);
   }
 
-  size_t CDataReader::AddSample(const std::string& tid_, const char* payload_, size_t size_, long long id_, long long clock_, long long time_, size_t hash_, eCAL::pb::eTLayerType layer_)
+  size_t CDataReader::AddSample(const std::string& tid_, const char* payload_, size_t size_, long long id_, long long clock_, long long time_, size_t hash_, eCAL::pb::eTLayerType layer_, bool batch_)
   {
     // ensure thread safety
     std::lock_guard<std::mutex> lock(m_receive_callback_sync);
@@ -497,17 +617,21 @@ namespace eCAL
     m_use_udp_uc_confirmed    |= layer_ == eCAL::pb::tl_ecal_udp_uc;
     m_use_udp_metal_confirmed |= layer_ == eCAL::pb::tl_ecal_udp_metal;
     m_use_shm_confirmed       |= layer_ == eCAL::pb::tl_ecal_shm;
+#ifdef ECAL_LAYER_LCM
     m_use_lcm_confirmed       |= layer_ == eCAL::pb::tl_lcm;
+#endif /* ECAL_LAYER_LCM */
     m_use_rtps_confirmed      |= layer_ == eCAL::pb::tl_rtps;
     m_use_inproc_confirmed    |= layer_ == eCAL::pb::tl_inproc;
 
+    // update latency and inter arrival statistics
+    const long long arrival = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+    UpdateLayerStatistics(layer_, time_, arrival);
+
     // use hash to discard multiple receives of the same payload
-    //   first we remove outdated hashes
-    m_sample_hash.remove_deprecated();
-    //   if this hash is still in the map
-    //   we received it recently (on another transport layer ?)
-    //   so we return and do not process this sample again
-    if (m_sample_hash.find(hash_) != m_sample_hash.end())
+    //   if this hash is already known we received it recently
+    //   (on another transport layer ?) so we return and
+    //   do not process this sample again
+    if (!m_sample_hash.insert(hash_, arrival))
     {
 #ifndef NDEBUG
       // log it
@@ -515,9 +639,31 @@ namespace eCAL
 #endif
       return(size_);
     }
-    //   this is a new sample -> store it's hash
-    m_sample_hash[hash_] = 0;
 
+    // unpack publisher batch frame, every sample keeps its own id, clock and time
+    if (batch_)
+    {
+      const size_t      frame_hash  = hash_;
+      const long long   frame_clock = clock_;
+      auto process = [this, &tid_, frame_hash, frame_clock, arrival](const char* buf_, size_t len_, long long id_, long long clock_, long long time_)
+      {
+        // the sample may have been received on its own already
+        // (lcm and rtps send batched samples one by one)
+        if (!m_sample_hash.insert(BatchSampleHash(frame_hash, frame_clock, clock_), arrival)) return;
+        ProcessSample(tid_, buf_, len_, id_, clock_, time_);
+      };
+      if (!ForEachBatchSample(payload_, size_, process))
+      {
+        Logging::Log(log_level_warning, m_topic_name + "::CDataReader::AddSample received malformed batch frame");
+      }
+      return(size_);
+    }
+
+    return(ProcessSample(tid_, payload_, size_, id_, clock_, time_));
+  }
+
+  size_t CDataReader::ProcessSample(const std::string& tid_, const char* payload_, size_t size_, long long id_, long long clock_, long long time_)
+  {
     // check id
     if (!m_id_set.empty())
     {
@@ -548,7 +694,22 @@ namespace eCAL
     bool processed = false;
     {
       // call user receive callback function
-      if(m_receive_callback)
+      if(m_receive_callback && m_dispatch_queue)
+      {
+        // hand over to the dispatcher threads, samples dropped
+        // by the queue overflow policy count as message drops
+        const size_t dropped = m_dispatch_queue->Push(payload_, size_, id_, time_, clock_);
+        if (dropped > 0)
+        {
+          m_message_drops += static_cast<long long>(dropped);
+#ifndef NDEBUG
+          // log it
+          Logging::Log(log_level_debug3, m_topic_name + "::CDataReader::AddSample::Dispatch::QueueFull - DROPPED");
+#endif
+        }
+        processed = true;
+      }
+      else if(m_receive_callback)
       {
 #ifndef NDEBUG
         // log it
@@ -562,6 +723,7 @@ namespace eCAL
         cb_data.time  = time_;
         cb_data.clock = clock_;
         // execute it
+        ECAL_TRACE_SCOPE(probe_reader_callback, clock_);
         (m_receive_callback)(m_topic_name.c_str(), &cb_data);
         processed = true;
       }
@@ -570,11 +732,32 @@ namespace eCAL
     // if not consumed by user receive call
     if(!processed)
     {
-      // push sample into read buffer
+      // push sample into receive queue
       std::lock_guard<std::mutex> lock1(m_read_buf_sync);
-      m_read_buf.clear();
-      m_read_buf.assign(payload_, payload_ + size_);
-      m_read_time = time_;
+      if (m_read_queue.empty()) return(0);
+
+      if (m_read_queue_count == m_read_queue.size())
+      {
+        if (m_qos.history_kind == QOS::keep_all_history_qos)
+        {
+          // queue full, keep all queued samples and account the new one as dropped
+          m_message_drops++;
+#ifndef NDEBUG
+          // log it
+          Logging::Log(log_level_debug3, m_topic_name + "::CDataReader::AddSample::Receive::QueueFull - DROPPED");
+#endif
+          return(0);
+        }
+
+        // keep last, drop the oldest sample
+        m_read_queue_head = (m_read_queue_head + 1) % m_read_queue.size();
+        m_read_queue_count--;
+      }
+
+      SReadSample& sample = m_read_queue[(m_read_queue_head + m_read_queue_count) % m_read_queue.size()];
+      sample.buf.assign(payload_, payload_ + size_);
+      sample.time = time_;
+      m_read_queue_count++;
 
       // inform receive
       gSetEvent(m_receive_event);
@@ -600,6 +783,10 @@ namespace eCAL
 #endif
       m_receive_callback = callback_;
     }
+    {
+      std::lock_guard<std::mutex> lock(m_dispatch_callback_sync);
+      m_dispatch_callback = callback_;
+    }
 
     return(true);
   }
@@ -618,9 +805,33 @@ namespace eCAL
       m_receive_callback = nullptr;
     }
 
+    // wait for a running dispatched callback
+    {
+      std::lock_guard<std::mutex> lock(m_dispatch_callback_sync);
+      m_dispatch_callback = nullptr;
+    }
+
     return(true);
   }
 
+  void CDataReader::DispatchSample(const CReaderDispatchQueue::SSample& sample_)
+  {
+    // executed by a dispatcher thread, the transport thread is not blocked here
+    std::lock_guard<std::mutex> lock(m_dispatch_callback_sync);
+    if (!m_dispatch_callback) return;
+
+    // prepare data struct
+    SReceiveCallbackData cb_data;
+    cb_data.buf   = const_cast<char*>(sample_.buf.data());
+    cb_data.size  = long(sample_.buf.size());
+    cb_data.id    = sample_.id;
+    cb_data.time  = sample_.time;
+    cb_data.clock = sample_.clock;
+    // execute it
+    ECAL_TRACE_SCOPE(probe_reader_callback, sample_.clock);
+    (m_dispatch_callback)(m_topic_name.c_str(), &cb_data);
+  }
+
   bool CDataReader::AddEventCallback(eCAL_Subscriber_Event type_, SubEventCallbackT callback_)
   {
     if (!m_created) return(false);
@@ -727,11 +938,13 @@ namespace eCAL
       CSHMLayer::Get()->ApplyLayerParameter(par);
       break;
     }
+#ifdef ECAL_LAYER_LCM
     case eCAL::pb::tl_lcm:
     {
       CLcmLayer::Get()->ApplyLayerParameter(par);
       break;
     }
+#endif /* ECAL_LAYER_LCM */
 #ifdef ECAL_LAYER_FASTRTPS
     case eCAL::pb::tl_rtps:
     {
@@ -814,13 +1027,60 @@ namespace eCAL
         }
         m_message_drops += drops;
       }
-      iter->second = counter_;
+      // late samples of concurrent send calls do not move the counter back
+      if (drops > 0) iter->second = counter_;
     }
     else
     {
       m_writer_counter_map[tid_] = counter_;
     }
   }
+
+  void CDataReader::UpdateLayerStatistics(eCAL::pb::eTLayerType layer_, long long time_, long long arrival_)
+  {
+    int idx(0);
+    for (; idx < m_layer_stats_count; ++idx)
+    {
+      if (g_stats_layer[idx] == layer_) break;
+    }
+    if (idx == m_layer_stats_count) return;
+
+    // create layer statistics on first receive
+    SLayerStatistics* stats = m_layer_stats[idx].load(std::memory_order_acquire);
+    if (stats == nullptr)
+    {
+      SLayerStatistics* new_stats = new SLayerStatistics;
+      if (m_layer_stats[idx].compare_exchange_strong(stats, new_stats, std::memory_order_acq_rel))
+      {
+        stats = new_stats;
+      }
+      else
+      {
+        delete new_stats;
+      }
+    }
+
+    // send -> receive latency (sender time stamp is the synchronized eCAL time)
+    stats->latency.Add(eCAL::Time::GetMicroSeconds() - time_);
+
+    // inter arrival time
+    const long long last_arrival = stats->last_arrival.exchange(arrival_, std::memory_order_relaxed);
+    if (last_arrival != 0) stats->interarrival.Add(arrival_ - last_arrival);
+  }
+
+  void CDataReader::RegisterLayerStatistics(eCAL::pb::Topic* topic_)
+  {
+    for (int idx = 0; idx < m_layer_stats_count; ++idx)
+    {
+      const SLayerStatistics* stats = m_layer_stats[idx].load(std::memory_order_acquire);
+      if (stats == nullptr) continue;
+
+      auto tlstats = topic_->add_tlstats();
+      tlstats->set_type(g_stats_layer[idx]);
+      SetHistogramMsg(stats->latency, tlstats->mutable_latency());
+      SetHistogramMsg(stats->interarrival, tlstats->mutable_interarrival());
+    }
+  }
     
   void CDataReader::RefreshRegistration()
   {
@@ -932,8 +1192,8 @@ namespace eCAL
     out << indent_ << "m_topic_type:           " << m_topic_type           << std::endl;
     out << indent_ << "m_topic_desc:           " << m_topic_desc           << std::endl;
     out << indent_ << "m_topic_size:           " << m_topic_size           << std::endl;
-    out << indent_ << "m_read_buf.size():      " << m_read_buf.size()      << std::endl;
-    out << indent_ << "m_read_time:            " << m_read_time            << std::endl;
+    out << indent_ << "m_read_queue.size():    " << m_read_queue.size()    << std::endl;
+    out << indent_ << "m_read_queue_count:     " << m_read_queue_count     << std::endl;
     out << indent_ << "m_clock:                " << m_clock                << std::endl;
     out << indent_ << "m_rec_time:             " << std::chrono::duration_cast<std::chrono::milliseconds>(m_rec_time.time_since_epoch()).count() << std::endl;
     out << indent_ << "m_freq:                 " << m_freq                 << std::endl;
@@ -36,6 +36,9 @@
 #endif
 
 #include "ecal_expmap.h"
+#include "ecal_histogram.h"
+#include "ecal_sample_filter.h"
+#include "readwrite/ecal_reader_dispatch.h"
 
 #include <mutex>
 #include <atomic>
@@ -60,6 +63,7 @@ namespace eCAL
     bool SetQOS(QOS::SReaderQOS qos_);
 
     size_t Receive(std::string& buf_, long long* time_ = nullptr, int rcv_timeout_ = 0);
+    bool   Receive(const ReceiveBufferT& consumer_, long long* time_ = nullptr, int rcv_timeout_ = 0);
 
     bool AddReceiveCallback(ReceiveCallbackT callback_);
     bool RemReceiveCallback();
@@ -90,7 +94,7 @@ namespace eCAL
     void RefreshRegistration();
     void CheckReceiveTimeout();
 
-    size_t AddSample(const std::string& tid_, const char* payload_, size_t size_, long long id_, long long clock_, long long time_, size_t hash_, eCAL::pb::eTLayerType layer_);
+    size_t AddSample(const std::string& tid_, const char* payload_, size_t size_, long long id_, long long clock_, long long time_, size_t hash_, eCAL::pb::eTLayerType layer_, bool batch_);
 
   protected:
     void StartDataLayers();
@@ -99,6 +103,18 @@ namespace eCAL
     bool DoRegister(const bool force_);
     void SetConnected(bool state_);
     void CheckCounter(const std::string& tid_, long long counter_);
+    void UpdateLayerStatistics(eCAL::pb::eTLayerType layer_, long long time_, long long arrival_);
+    void RegisterLayerStatistics(eCAL::pb::Topic* topic_);
+    void DispatchSample(const CReaderDispatchQueue::SSample& sample_);
+    size_t ProcessSample(const std::string& tid_, const char* payload_, size_t size_, long long id_, long long clock_, long long time_);
+
+    struct SLayerStatistics
+    {
+      SLayerStatistics() : last_arrival(0) {};
+      Util::CHistogram        latency;       // send -> receive latency [us]
+      Util::CHistogram        interarrival;  // receive inter arrival time [us]
+      std::atomic<long long>  last_arrival;  // last receive time [us, steady clock]
+    };
 
     std::string                               m_host_name;
     int                                       m_pid;
@@ -120,17 +136,28 @@ namespace eCAL
 
     EventHandleT                              m_receive_event;
 
+    struct SReadSample
+    {
+      SReadSample() : time(0) {};
+      std::vector<char>  buf;
+      long long          time;
+    };
     std::mutex                                m_read_buf_sync;
-    std::vector<char>                         m_read_buf;
-    long long                                 m_read_time;
+    std::vector<SReadSample>                  m_read_queue;        // preallocated sample ring (qos history depth)
+    size_t                                    m_read_queue_head;   // index of the oldest queued sample
+    size_t                                    m_read_queue_count;  // number of queued samples
 
     std::mutex                                m_receive_callback_sync;
     ReceiveCallbackT                          m_receive_callback;
+
+    // callback executed by the reader dispatcher threads (if enabled)
+    std::shared_ptr<CReaderDispatchQueue>     m_dispatch_queue;
+    std::mutex                                m_dispatch_callback_sync;
+    ReceiveCallbackT                          m_dispatch_callback;
     std::atomic<int>                          m_receive_timeout;
     std::atomic<int>                          m_receive_time;
 
-    typedef Util::CExpMap<size_t, size_t>     SampleHashMapT;
-    SampleHashMapT                            m_sample_hash;
+    Util::CSampleHashFilter                   m_sample_hash;
 
     std::mutex                                m_event_callback_sync;
     typedef std::map<eCAL_Subscriber_Event, SubEventCallbackT> EventCallbackMapT;
@@ -151,6 +178,9 @@ namespace eCAL
     WriterCounterMapT                         m_writer_counter_map;
     long long                                 m_message_drops;
 
+    static const int                          m_layer_stats_count = 7;
+    std::atomic<SLayerStatistics*>            m_layer_stats[m_layer_stats_count];
+
     std::atomic<bool>                         m_loc_published;
     std::atomic<bool>                         m_ext_published;
 
@@ -161,7 +191,9 @@ namespace eCAL
     bool                                      m_use_udp_uc_confirmed;
     bool                                      m_use_udp_metal_confirmed;
     bool                                      m_use_shm_confirmed;
+#ifdef ECAL_LAYER_LCM
     bool                                      m_use_lcm_confirmed;
+#endif /* ECAL_LAYER_LCM */
     bool                                      m_use_rtps_confirmed;
     bool                                      m_use_inproc_confirmed;
 
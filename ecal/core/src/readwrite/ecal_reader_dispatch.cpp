@@ -0,0 +1,210 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright (C) 2016 - 2019 Continental Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+
+/**
+ * @brief  eCAL data reader callback dispatcher
+**/
+
+#include <ecal/ecal.h>
+
+#include "ecal_def.h"
+#include "ecal_config_hlp.h"
+#include "ecal_global_accessors.h"
+#include "ecal_thread.h"
+#include "readwrite/ecal_reader_dispatch.h"
+
+#include <algorithm>
+
+namespace eCAL
+{
+  // maximum number of samples one worker executes per queue before serving the next queue
+  static const size_t g_dispatch_batch_size = 64;
+
+  ////////////////////////////////////////
+  // CReaderDispatchQueue
+  ////////////////////////////////////////
+  CReaderDispatchQueue::CReaderDispatchQueue(size_t capacity_, eDispatchOverflowPolicy policy_, ExecuteCallbackT execute_) :
+    m_queue(capacity_),
+    m_policy(policy_),
+    m_execute(execute_),
+    m_scheduled(false),
+    m_closed(false)
+  {
+  }
+
+  size_t CReaderDispatchQueue::Push(const char* payload_, size_t size_, long long id_, long long time_, long long clock_)
+  {
+    if (m_closed) return(1);
+
+    auto fill = [&](SSample& sample_)
+    {
+      sample_.buf.assign(payload_, size_);
+      sample_.id    = id_;
+      sample_.time  = time_;
+      sample_.clock = clock_;
+    };
+
+    size_t dropped(0);
+    if (!m_queue.push(fill))
+    {
+      // drop newest, reject the incoming sample
+      if (m_policy != dispatch_drop_oldest) return(1);
+
+      // drop oldest, make room by discarding the oldest sample
+      m_queue.pop([](SSample&) {});
+      dropped++;
+      if (!m_queue.push(fill)) dropped++;
+    }
+
+    // schedule queue if it is not already waiting for / in execution
+    if (!m_scheduled.exchange(true))
+    {
+      CReaderDispatcher* dispatcher = g_reader_dispatcher();
+      if (dispatcher) dispatcher->Schedule(shared_from_this());
+    }
+
+    return(dropped);
+  }
+
+  void CReaderDispatchQueue::Close()
+  {
+    m_closed = true;
+
+    // wait for a running execution
+    std::lock_guard<std::mutex> lock(m_execute_sync);
+    m_execute = nullptr;
+  }
+
+  void CReaderDispatchQueue::Execute(size_t max_samples_)
+  {
+    {
+      std::lock_guard<std::mutex> lock(m_execute_sync);
+      for (size_t cnt = 0; cnt < max_samples_; ++cnt)
+      {
+        if (m_closed) break;
+        if (!m_queue.pop([this](SSample& sample_) { if (m_execute) m_execute(sample_); })) break;
+      }
+    }
+
+    // samples pushed after our last pop could not schedule us, so check again
+    m_scheduled = false;
+    if (!m_closed && !m_queue.empty() && !m_scheduled.exchange(true))
+    {
+      CReaderDispatcher* dispatcher = g_reader_dispatcher();
+      if (dispatcher) dispatcher->Schedule(shared_from_this());
+    }
+  }
+
+  ////////////////////////////////////////
+  // CReaderDispatcher
+  ////////////////////////////////////////
+  CReaderDispatcher::CReaderDispatcher() :
+    m_created(false),
+    m_stop(false),
+    m_queue_size(SUB_CALLBACK_QUEUE_SIZE),
+    m_policy(dispatch_drop_newest)
+  {
+  }
+
+  CReaderDispatcher::~CReaderDispatcher()
+  {
+    Destroy();
+  }
+
+  void CReaderDispatcher::Create()
+  {
+    if (m_created) return;
+
+    // dispatching is opt-in
+    const int threads = eCALPAR(SUB, CALLBACK_THREADS);
+    if (threads <= 0) return;
+
+    m_queue_size = static_cast<size_t>(std::max(1, eCALPAR(SUB, CALLBACK_QUEUE_SIZE)));
+    m_policy     = (eCALPAR(SUB, CALLBACK_OVERFLOW) == dispatch_drop_oldest) ? dispatch_drop_oldest : dispatch_drop_newest;
+
+    {
+      std::lock_guard<std::mutex> lock(m_run_sync);
+      m_stop = false;
+    }
+    for (int i = 0; i < threads; ++i)
+    {
+      m_workers.emplace_back(&CReaderDispatcher::Worker, this);
+    }
+
+    m_created = true;
+  }
+
+  void CReaderDispatcher::Destroy()
+  {
+    if (!m_created) return;
+    m_created = false;
+
+    // stop workers
+    {
+      std::lock_guard<std::mutex> lock(m_run_sync);
+      m_stop = true;
+    }
+    m_run_cv.notify_all();
+    for (auto& worker : m_workers)
+    {
+      if (worker.joinable()) worker.join();
+    }
+    m_workers.clear();
+
+    // release pending queues
+    std::lock_guard<std::mutex> lock(m_run_sync);
+    m_run_queue.clear();
+  }
+
+  std::shared_ptr<CReaderDispatchQueue> CReaderDispatcher::CreateQueue(CReaderDispatchQueue::ExecuteCallbackT execute_)
+  {
+    if (!m_created) return(nullptr);
+    return(std::make_shared<CReaderDispatchQueue>(m_queue_size, m_policy, execute_));
+  }
+
+  void CReaderDispatcher::Schedule(const std::shared_ptr<CReaderDispatchQueue>& queue_)
+  {
+    {
+      std::lock_guard<std::mutex> lock(m_run_sync);
+      if (m_stop) return;
+      m_run_queue.push_back(queue_);
+    }
+    m_run_cv.notify_one();
+  }
+
+  void CReaderDispatcher::Worker()
+  {
+    // thread name, scheduling and affinity of the callback class
+    SetCurrentThreadAttr(Thread::thread_class_callback, "ecal_sub_cb");
+
+    for (;;)
+    {
+      std::shared_ptr<CReaderDispatchQueue> queue;
+      {
+        std::unique_lock<std::mutex> lock(m_run_sync);
+        m_run_cv.wait(lock, [this] { return(m_stop || !m_run_queue.empty()); });
+        if (m_stop) return;
+        queue = m_run_queue.front();
+        m_run_queue.pop_front();
+      }
+      queue->Execute(g_dispatch_batch_size);
+    }
+  }
+}
@@ -0,0 +1,127 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright (C) 2016 - 2019 Continental Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+
+/**
+ * @brief  eCAL data reader callback dispatcher
+**/
+
+#pragma once
+
+#include "ecal_bounded_queue.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace eCAL
+{
+  /**
+  * @brief Overflow behavior of a full dispatch queue.
+  **/
+  enum eDispatchOverflowPolicy
+  {
+    dispatch_drop_newest = 0,   //!< reject the incoming sample
+    dispatch_drop_oldest = 1,   //!< discard the oldest queued sample
+  };
+
+  /**
+  * @brief Per reader queue of samples waiting for callback execution.
+  *
+  * The transport thread only copies the sample into a preallocated slot and
+  * schedules the queue on the dispatcher, so it returns in bounded time.
+  * Samples of one queue are executed strictly in order by one worker at a time.
+  **/
+  class CReaderDispatchQueue : public std::enable_shared_from_this<CReaderDispatchQueue>
+  {
+  public:
+    struct SSample
+    {
+      SSample() : id(0), time(0), clock(0) {};
+      std::string buf;
+      long long   id;
+      long long   time;
+      long long   clock;
+    };
+    typedef std::function<void(const SSample&)> ExecuteCallbackT;
+
+    CReaderDispatchQueue(size_t capacity_, eDispatchOverflowPolicy policy_, ExecuteCallbackT execute_);
+
+    /**
+    * @brief  queue a sample (called by the transport thread)
+    *
+    * @return  number of samples dropped by the overflow policy (the incoming or the oldest one)
+    **/
+    size_t Push(const char* payload_, size_t size_, long long id_, long long time_, long long clock_);
+
+    /**
+    * @brief  stop dispatching, blocks until a running callback returned
+    **/
+    void Close();
+
+  protected:
+    friend class CReaderDispatcher;
+    void Execute(size_t max_samples_);
+
+    Util::CBoundedQueue<SSample>  m_queue;
+    eDispatchOverflowPolicy       m_policy;
+    ExecuteCallbackT              m_execute;
+    std::mutex                    m_execute_sync;
+    std::atomic<bool>             m_scheduled;
+    std::atomic<bool>             m_closed;
+  };
+
+  /**
+  * @brief Thread pool executing the receive callbacks of all dispatched readers.
+  *
+  * Dispatching is opt-in ([subscriber] callback_threads > 0), otherwise readers
+  * execute their callbacks synchronously on the transport thread.
+  **/
+  class CReaderDispatcher
+  {
+  public:
+    CReaderDispatcher();
+    ~CReaderDispatcher();
+
+    void Create();
+    void Destroy();
+
+    std::shared_ptr<CReaderDispatchQueue> CreateQueue(CReaderDispatchQueue::ExecuteCallbackT execute_);
+
+  protected:
+    friend class CReaderDispatchQueue;
+    void Schedule(const std::shared_ptr<CReaderDispatchQueue>& queue_);
+    void Worker();
+
+    std::atomic<bool>                                  m_created;
+    bool                                               m_stop;
+    size_t                                             m_queue_size;
+    eDispatchOverflowPolicy                            m_policy;
+    std::mutex                                         m_run_sync;
+    std::condition_variable                            m_run_cv;
+    std::deque<std::shared_ptr<CReaderDispatchQueue>>  m_run_queue;
+    std::vector<std::thread>                           m_workers;
+  };
+}
@@ -44,13 +44,13 @@ namespace eCAL
   // start layer
   // activate / create a inproc subscription with defined 
   // quality of service settings if supported
-  void CInProcLayer::StartLayer(std::string& /*topic_name_*/, QOS::SReaderQOS /*qos_*/)
+  void CInProcLayer::StartLayer(std::string& /*topic_name_*/, const std::string& /*topic_id_*/, QOS::SReaderQOS /*qos_*/)
   {
   }
 
   // stop layer
   // deactivate / destroy a specific inproc subscription
-  void CInProcLayer::StopLayer(std::string& /*topic_name_*/)
+  void CInProcLayer::StopLayer(std::string& /*topic_name_*/, const std::string& /*topic_id_*/)
   {
   }
 
@@ -44,8 +44,8 @@ namespace eCAL
 
     void InitializeLayer();
 
-    void StartLayer(std::string& topic_name_, QOS::SReaderQOS qos_);
-    void StopLayer(std::string& topic_name_);
+    void StartLayer(std::string& topic_name_, const std::string& topic_id_, QOS::SReaderQOS qos_);
+    void StopLayer(std::string& topic_name_, const std::string& topic_id_);
 
     void ApplyLayerParameter(SReaderLayerPar& par_);
 
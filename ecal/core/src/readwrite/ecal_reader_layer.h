@@ -50,8 +50,8 @@ namespace eCAL
 
     virtual void InitializeLayer() = 0;
 
-    virtual void StartLayer(std::string& topic_name_, QOS::SReaderQOS qos_) = 0;
-    virtual void StopLayer(std::string& topic_name_) = 0;
+    virtual void StartLayer(std::string& topic_name_, const std::string& topic_id_, QOS::SReaderQOS qos_) = 0;
+    virtual void StopLayer(std::string& topic_name_, const std::string& topic_id_) = 0;
 
     virtual void ApplyLayerParameter(SReaderLayerPar& par_) = 0;
 
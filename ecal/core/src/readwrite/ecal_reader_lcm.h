@@ -74,18 +74,18 @@ namespace eCAL
       // we need to start monitoring and data layer thread
       // because the monitoring information is on the data
       // layer in lcm
-      mon_thread.Start(1000, std::bind(&CDataReaderLCM::Monitor, &reader));
-      rec_thread.Start(0, std::bind(&CDataReaderLCM::Receive, &reader));
+      mon_thread.Start(1000, std::bind(&CDataReaderLCM::Monitor, &reader), Thread::thread_class_udp_receive, "ecal_lcm_mon");
+      rec_thread.Start(0, std::bind(&CDataReaderLCM::Receive, &reader), Thread::thread_class_udp_receive, "ecal_lcm_rcv");
       initialzed = true;
     }
 
-    void StartLayer(std::string& /*topic_name_*/, QOS::SReaderQOS /*qos_*/)
+    void StartLayer(std::string& /*topic_name_*/, const std::string& /*topic_id_*/, QOS::SReaderQOS /*qos_*/)
     {
       if (started) return;
       started = true;
     }
 
-    void StopLayer(std::string& /*topic_name_*/)
+    void StopLayer(std::string& /*topic_name_*/, const std::string& /*topic_id_*/)
     {
     }
 
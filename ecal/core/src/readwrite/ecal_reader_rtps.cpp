@@ -155,7 +155,7 @@ namespace eCAL
         this->n_samples++;
 
         // apply data to subscriber gate
-        if (g_subgate()) g_subgate()->ApplySample(sub_->getAttributes().topic.topicName, m_string_msg.tid(), m_string_msg.payload().data(), m_string_msg.payload().size(), m_string_msg.id(), m_string_msg.clock(), m_string_msg.time(), static_cast<size_t>(m_string_msg.hash()), eCAL::pb::eTLayerType::tl_rtps);
+        if (g_subgate()) g_subgate()->ApplySample(sub_->getAttributes().topic.topicName, m_string_msg.tid(), m_string_msg.payload().data(), m_string_msg.payload().size(), m_string_msg.id(), m_string_msg.clock(), m_string_msg.time(), static_cast<size_t>(m_string_msg.hash()), eCAL::pb::eTLayerType::tl_rtps, false);
       }
     }
   }
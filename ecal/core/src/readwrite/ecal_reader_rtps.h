@@ -94,12 +94,12 @@ namespace eCAL
     {
     }
 
-    void StartLayer(std::string& topic_name_, QOS::SReaderQOS qos_)
+    void StartLayer(std::string& topic_name_, const std::string& /*topic_id_*/, QOS::SReaderQOS qos_)
     {
       reader.CreateRtpsSub(topic_name_, qos_);
     }
 
-    void StopLayer(std::string& topic_name_)
+    void StopLayer(std::string& topic_name_, const std::string& /*topic_id_*/)
     {
       reader.DestroyRtpsSub(topic_name_);
     }
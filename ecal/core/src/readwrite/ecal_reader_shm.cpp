@@ -38,6 +38,27 @@ namespace eCAL
   {
   }
 
+  void CSHMLayer::StartLayer(std::string& topic_name_, const std::string& topic_id_, QOS::SReaderQOS qos_)
+  {
+    // the receive thread of a topic is created on the first
+    // registration of a publisher, so we keep the qos until then,
+    // a running receive thread takes the changed options immediately
+    std::lock_guard<std::mutex> lock(m_topic_qos_sync);
+    m_topic_qos[topic_name_][topic_id_] = qos_;
+    if (g_memfile_pool()) g_memfile_pool()->SetObserverOptions(topic_name_, GetObserverOpt(topic_name_));
+  }
+
+  void CSHMLayer::StopLayer(std::string& topic_name_, const std::string& topic_id_)
+  {
+    // remove the entry of this subscriber only
+    std::lock_guard<std::mutex> lock(m_topic_qos_sync);
+    auto iter = m_topic_qos.find(topic_name_);
+    if (iter == m_topic_qos.end()) return;
+    iter->second.erase(topic_id_);
+    if (iter->second.empty()) m_topic_qos.erase(iter);
+    if (g_memfile_pool()) g_memfile_pool()->SetObserverOptions(topic_name_, GetObserverOpt(topic_name_));
+  }
+
   void CSHMLayer::ApplyLayerParameter(SReaderLayerPar& par_)
   {
     std::string memfile_name = par_.parameter;
@@ -46,10 +67,31 @@ namespace eCAL
       // start memory file receive thread if topic is subscribed in this process
       if (g_memfile_pool())
       {
+        std::lock_guard<std::mutex> lock(m_topic_qos_sync);
         std::string process_id = std::to_string(Process::GetProcessID());
         std::string memfile_event = memfile_name + "_" + process_id;
-        g_memfile_pool()->AssignThread(par_.topic_id, memfile_event, memfile_name, par_.topic_name);
+        g_memfile_pool()->AssignThread(par_.topic_id, memfile_event, memfile_name, par_.topic_name, GetObserverOpt(par_.topic_name));
+      }
+    }
+  }
+
+  SMemFileObserverOpt CSHMLayer::GetObserverOpt(const std::string& topic_name_)
+  {
+    // the shared receive thread spins as long as the most demanding
+    // subscriber of the topic asks for, pinned to the cpu of that one
+    // (caller has to hold m_topic_qos_sync)
+    SMemFileObserverOpt observer_opt;
+    auto iter = m_topic_qos.find(topic_name_);
+    if (iter == m_topic_qos.end()) return(observer_opt);
+    for (const auto& reader : iter->second)
+    {
+      const QOS::SReaderQOS& qos = reader.second;
+      if ((qos.shm_spin_time > observer_opt.spin_time) || ((observer_opt.spin_cpu < 0) && (qos.shm_spin_time == observer_opt.spin_time)))
+      {
+        observer_opt.spin_time = qos.shm_spin_time;
+        observer_opt.spin_cpu  = qos.shm_spin_cpu;
       }
     }
+    return(observer_opt);
   }
 }
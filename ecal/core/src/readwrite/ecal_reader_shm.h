@@ -25,8 +25,12 @@
 
 #include "ecal_def.h"
 #include "readwrite/ecal_reader_layer.h"
+#include "io/ecal_memfile_pool.h"
 
 #include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
 
 namespace eCAL
 {
@@ -53,14 +57,18 @@ namespace eCAL
     {
     }
 
-    void StartLayer(std::string& /*topic_name_*/, QOS::SReaderQOS /*qos_*/)
-    {
-    }
-
-    void StopLayer(std::string& /*topic_name_*/)
-    {
-    }
+    void StartLayer(std::string& topic_name_, const std::string& topic_id_, QOS::SReaderQOS qos_);
+    void StopLayer(std::string& topic_name_, const std::string& topic_id_);
 
     void ApplyLayerParameter(SReaderLayerPar& par_);
+
+  private:
+    SMemFileObserverOpt GetObserverOpt(const std::string& topic_name_);
+
+    // topic name -> subscriber topic id -> qos,
+    // the subscribers of a topic share one receive thread
+    typedef std::unordered_map<std::string, QOS::SReaderQOS> ReaderQOSMapT;
+    std::mutex                                            m_topic_qos_sync;
+    std::unordered_map<std::string, ReaderQOSMapT>        m_topic_qos;
   };
 }
@@ -58,11 +58,11 @@ namespace eCAL
       rcv.Create(attr);
     }
 
-    void StartLayer(std::string& topic_name_, QOS::SReaderQOS /*qos_*/)
+    void StartLayer(std::string& topic_name_, const std::string& /*topic_id_*/, QOS::SReaderQOS /*qos_*/)
     {
       if (!started)
       {
-        thread.Start(0, std::bind(&CDataReaderUDP::Receive, &reader, &rcv));
+        thread.Start(0, std::bind(&CDataReaderUDP::Receive, &reader, &rcv), Thread::thread_class_udp_receive, "ecal_udp_mc");
         started = true;
       }
       // add topic name based multicast address
@@ -74,7 +74,7 @@ namespace eCAL
       }
     }
 
-    void StopLayer(std::string& /*topic_name_*/)
+    void StopLayer(std::string& /*topic_name_*/, const std::string& /*topic_id_*/)
     {
     }
 
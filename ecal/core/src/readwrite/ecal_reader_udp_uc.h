@@ -56,14 +56,14 @@ namespace eCAL
       rcv.Create(attr);
     }
 
-    void StartLayer(std::string& /*topic_name_*/, QOS::SReaderQOS /*qos_*/)
+    void StartLayer(std::string& /*topic_name_*/, const std::string& /*topic_id_*/, QOS::SReaderQOS /*qos_*/)
     {
       if (started) return;
-      thread.Start(0, std::bind(&CDataReaderUDP::Receive, &reader, &rcv));
+      thread.Start(0, std::bind(&CDataReaderUDP::Receive, &reader, &rcv), Thread::thread_class_udp_receive, "ecal_udp_uc");
       started = true;
     }
 
-    void StopLayer(std::string& /*topic_name_*/)
+    void StopLayer(std::string& /*topic_name_*/, const std::string& /*topic_id_*/)
     {
     }
 
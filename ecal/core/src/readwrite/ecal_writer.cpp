@@ -30,33 +30,16 @@
 #include "ecal_writer_base.h"
 
 #include "ecal_register.h"
+#include "ecal_trace.h"
 #include "pubsub/ecal_pubgate.h"
+#include "readwrite/ecal_batch.h"
+#include "readwrite/ecal_compression.h"
 
+#include <algorithm>
 #include <sstream>
 #include <chrono>
 #include <functional>
 
-struct SSndHash
-{
-  SSndHash(std::string t, long long c) : topic_id(t), snd_clock(c) {}
-  std::string topic_id;
-  long long   snd_clock;
-};
-
-namespace std
-{
-  template<>
-  class hash<SSndHash> {
-  public:
-    size_t operator()(const SSndHash &h) const
-    {
-      size_t h1 = std::hash<std::string>()(h.topic_id);
-      size_t h2 = std::hash<long long>()(h.snd_clock);
-      return h1 ^ (h2 << 1);
-    }
-  };
-}
-
 namespace eCAL
 {
   class CProtoBufProducer : public CMemProducer
@@ -95,6 +78,15 @@ namespace eCAL
     m_freq_min_err(0),
     m_freq_max_err(0),
     m_bandwidth_max_udp(NET_BANDWIDTH_MAX_UDP),
+    m_batch_enabled(false),
+    m_batch_max_messages(0),
+    m_batch_max_bytes(0),
+    m_batch_max_delay(0),
+    m_batch_count(0),
+    m_batch_time(0),
+    m_udp_compression(TLayer::compression_none),
+    m_udp_compression_agreed(false),
+    m_send_plan(0),
     m_loc_subscribed(false),
     m_ext_subscribed(false),
     m_use_udp_mc(TLayer::eSendMode(eCALPAR(PUB, USE_UDP_MC))),
@@ -103,8 +95,10 @@ namespace eCAL
     m_use_udp_uc_confirmed(false),
     m_use_shm(TLayer::eSendMode(eCALPAR(PUB, USE_SHM))),
     m_use_shm_confirmed(false),
+#ifdef ECAL_LAYER_LCM
     m_use_lcm(TLayer::eSendMode(eCALPAR(PUB, USE_LCM))),
     m_use_lcm_confirmed(false),
+#endif /* ECAL_LAYER_LCM */
 #ifdef ECAL_LAYER_FASTRTPS
     m_use_rtps(TLayer::eSendMode(eCALPAR(PUB, USE_RTPS))),
     m_use_rtps_confirmed(false),
@@ -150,11 +144,13 @@ namespace eCAL
     std::stringstream counter;
     counter << std::chrono::steady_clock::now().time_since_epoch().count();
     m_topic_id = counter.str();
+    m_topic_id_hash = std::hash<std::string>()(m_topic_id);
 
     // set registration expiration
     std::chrono::milliseconds registration_timeout(eCALPAR(CMN, REGISTRATION_TO));
     m_loc_sub_map.set_expiration(registration_timeout);
     m_ext_sub_map.set_expiration(registration_timeout);
+    m_udp_par_map.set_expiration(registration_timeout);
 
     // allow to share topic type
     m_use_ttype = eCALPAR(PUB, SHARE_TTYPE) != 0;
@@ -177,8 +173,10 @@ namespace eCAL
     // create shm layer
     SetUseShm(m_use_shm);
 
+#ifdef ECAL_LAYER_LCM
     // create lcm layer
     SetUseLcm(m_use_lcm);
+#endif /* ECAL_LAYER_LCM */
 
 #ifdef ECAL_LAYER_FASTRTPS
     // create rtps layer
@@ -188,6 +186,9 @@ namespace eCAL
     // create inproc layer
     SetUseInProc(m_use_inproc);
 
+    // prepare layers to send
+    UpdateSendPlan();
+
 #ifndef NDEBUG
     // log it
     Logging::Log(log_level_debug1, m_topic_name + "::CDataWriter::Created");
@@ -205,6 +206,14 @@ namespace eCAL
     Logging::Log(log_level_debug1, m_topic_name + "::CDataWriter::Destroy");
 #endif
 
+    // stop batching and send pending samples
+    m_batch_thread.Stop();
+    {
+      std::lock_guard<std::mutex> lock(m_batch_sync);
+      FlushBatch();
+      m_batch_enabled = false;
+    }
+
     // destroy udp multicast writer
     m_writer_udp_mc.Destroy();
 
@@ -214,8 +223,10 @@ namespace eCAL
     // destroy memory file writer
     m_writer_shm.Destroy();
 
+#ifdef ECAL_LAYER_LCM
     // destroy lcm writer
     m_writer_lcm.Destroy();
+#endif /* ECAL_LAYER_LCM */
 
 #ifdef ECAL_LAYER_FASTRTPS
     // destroy rtps writer
@@ -236,6 +247,7 @@ namespace eCAL
     m_freq_min_err      = 0;
     m_freq_max_err      = 0;
     m_bandwidth_max_udp = eCALPAR(NET, BANDWIDTH_MAX_UDP);
+    m_send_plan         = 0;
     m_created           = false;
 
     return(true);
@@ -306,8 +318,14 @@ namespace eCAL
       SetUseShm(mode_);
       break;
     case TLayer::tlayer_lcm:
+#ifdef ECAL_LAYER_LCM
       SetUseLcm(mode_);
       break;
+#else  /* ECAL_LAYER_LCM */
+      if (mode_ == TLayer::smode_off) break;
+      Logging::Log(log_level_warning, m_topic_name + "::CDataWriter::SetLayerMode - lcm layer not available in this build");
+      return false;
+#endif /* ECAL_LAYER_LCM */
 #ifdef ECAL_LAYER_FASTRTPS
     case TLayer::tlayer_rtps:
       SetUseRtps(mode_);
@@ -320,7 +338,9 @@ namespace eCAL
       SetUseUdpMC (mode_);
       SetUseUdpUC (mode_);
       SetUseShm   (mode_);
+#ifdef ECAL_LAYER_LCM
       SetUseLcm   (mode_);
+#endif /* ECAL_LAYER_LCM */
 #ifdef ECAL_LAYER_FASTRTPS
       SetUseRtps  (mode_);
 #endif /* ECAL_LAYER_FASTRTPS */
@@ -329,6 +349,10 @@ namespace eCAL
     default:
       break;
     }
+
+    // rebuild layers to send
+    if (m_created) UpdateSendPlan();
+
     return true;
   }
 
@@ -348,6 +372,77 @@ namespace eCAL
     return false;
   }
 
+  bool CDataWriter::SetCompressionUDP(TLayer::eCompression compression_)
+  {
+    if ((compression_ != TLayer::compression_none) && !Compression::IsAvailable(compression_))
+    {
+      Logging::Log(log_level_warning, m_topic_name + "::CDataWriter::SetCompressionUDP - codec not available in this build");
+      return false;
+    }
+
+    m_udp_compression = compression_;
+    UpdateCompressionAgreement();
+
+    // announce the codec in the udp layer parameter
+    DoRegister(true);
+    return true;
+  }
+
+  void CDataWriter::UpdateCompressionAgreement()
+  {
+    // compress only if there are subscribers and every
+    // known subscriber is able to decompress
+    bool agreed(m_udp_compression != TLayer::compression_none);
+    if (agreed)
+    {
+      std::lock_guard<std::mutex> lock(m_sub_map_sync);
+      if (m_udp_par_map.empty()) agreed = false;
+      for (auto sub : m_udp_par_map)
+      {
+        if (!Compression::HasCodec(sub.second, m_udp_compression))
+        {
+          agreed = false;
+          break;
+        }
+      }
+    }
+    m_udp_compression_agreed = agreed;
+  }
+
+  bool CDataWriter::SetBatching(size_t max_messages_, size_t max_bytes_, int max_delay_ms_)
+  {
+    // stop flush thread and send pending samples with the old settings
+    m_batch_thread.Stop();
+    {
+      std::lock_guard<std::mutex> lock(m_batch_sync);
+      FlushBatch();
+
+      m_batch_max_messages = max_messages_;
+      m_batch_max_bytes    = max_bytes_;
+      m_batch_max_delay    = max_delay_ms_;
+      m_batch_enabled      = max_messages_ > 1;
+    }
+
+#ifndef NDEBUG
+    // log it
+    Logging::Log(log_level_debug2, m_topic_name + "::CDataWriter::SetBatching - " + (m_batch_enabled ? "ON" : "OFF"));
+#endif
+
+    // flush batches by time
+    if (m_batch_enabled && (max_delay_ms_ > 0))
+    {
+      m_batch_thread.Start(std::max(1, max_delay_ms_ / 2), std::bind(&CDataWriter::BatchFlushThread, this), Thread::thread_class_publisher, "ecal_pub_batch");
+    }
+
+    return(true);
+  }
+
+  size_t CDataWriter::Flush()
+  {
+    std::lock_guard<std::mutex> lock(m_batch_sync);
+    return(FlushBatch());
+  }
+
   bool CDataWriter::AddEventCallback(eCAL_Publisher_Event type_, PubEventCallbackT callback_)
   {
     if (!m_created) return(false);
@@ -384,15 +479,32 @@ namespace eCAL
 
   size_t CDataWriter::Send(const void* const buf_, size_t len_, long long time_, long long id_)
   {
+    // batching mode, pack the sample into the pending batch frame
+    if (m_batch_enabled)
+    {
+      std::lock_guard<std::mutex> lock(m_batch_sync);
+      if (m_batch_enabled) return(AddBatchSample(buf_, len_, time_, id_));
+    }
+
     // store id
     m_id = id_;
 
-    // handle write counters
-    RefreshSendCounter();
+    // handle write counters, the clock of this sample is kept local
+    // so that concurrent send calls do not see each others clock
+    const long long clock = RefreshSendCounter();
 
-    // calculate unique send hash
-    std::hash<SSndHash> hf;
-    size_t snd_hash = hf(SSndHash(m_topic_id, m_clock));
+    // send it
+    return(SendFrame(buf_, len_, time_, id_, clock, false));
+  }
+
+  // returns the queued sample length, the frame itself is sent on flush
+  size_t CDataWriter::AddBatchSample(const void* const buf_, size_t len_, long long time_, long long id_)
+  {
+    // store id
+    m_id = id_;
+
+    // handle write counters, every batched sample keeps its own clock
+    const long long clock = RefreshSendCounter();
 
     // increase overall sum send
     g_process_sbytes_sum += len_;
@@ -400,75 +512,81 @@ namespace eCAL
     // store size for monitoring
     m_topic_size = len_;
 
-    // did we write anything
-    bool written(false);
+    // append to batch frame
+    if (m_batch_count == 0) m_batch_start = std::chrono::steady_clock::now();
+    AppendBatchSample(m_batch_buf, buf_, len_, id_, clock, time_);
+    m_batch_time = time_;
+    m_batch_count++;
 
-    // check send modes
-    TLayer::eSendMode use_udp_mc(m_use_udp_mc);
-    TLayer::eSendMode use_udp_uc(m_use_udp_uc);
-    TLayer::eSendMode use_shm(m_use_shm);
-    TLayer::eSendMode use_lcm(m_use_lcm);
-#ifdef ECAL_LAYER_FASTRTPS
-    TLayer::eSendMode use_rtps(m_use_rtps);
-#endif /* ECAL_LAYER_FASTRTPS */
-    TLayer::eSendMode use_inproc(m_use_inproc);
-    if ( (use_udp_mc == TLayer::smode_off)
-      && (use_udp_uc == TLayer::smode_off)
-      && (use_shm    == TLayer::smode_off)
-      && (use_lcm    == TLayer::smode_off)
-#ifdef ECAL_LAYER_FASTRTPS
-      && (use_rtps   == TLayer::smode_off)
-#endif /* ECAL_LAYER_FASTRTPS */
-      && (use_inproc == TLayer::smode_off)
+    // batch full ?
+    if ((m_batch_count >= m_batch_max_messages)
+      || ((m_batch_max_bytes > 0) && (m_batch_buf.size() >= m_batch_max_bytes))
       )
     {
-      // failsafe default mode if
-      // nothing is activated
-      use_udp_mc = TLayer::smode_auto;
-      use_shm    = TLayer::smode_auto;
+      FlushBatch();
     }
 
-    // if we do not have loopback
-    // enabled we can switch off
-    // inner process communication
-    if (g_reggate() && !g_reggate()->LoopBackEnabled())
-    {
-      use_inproc = TLayer::smode_off;
-    }
-    
-    // shared memory transport is on and
-    // inner process transport is on
-    // let's check if there is a need for
-    // shared memory because of external
-    // process subscription, if not
-    // let's switch it off
-    if  ((use_shm    != TLayer::smode_off)
-      && (use_inproc != TLayer::smode_off)
-      )
+    return(len_);
+  }
+
+  size_t CDataWriter::FlushBatch()
+  {
+    if (m_batch_count == 0) return(0);
+
+    size_t sent = SendFrame(m_batch_buf.data(), m_batch_buf.size(), m_batch_time, m_id, m_clock, true);
+
+    // reset batch frame (keeps the buffer capacity)
+    m_batch_buf.clear();
+    m_batch_count = 0;
+
+    return(sent);
+  }
+
+  int CDataWriter::BatchFlushThread()
+  {
+    std::lock_guard<std::mutex> lock(m_batch_sync);
+    if (m_batch_count == 0) return(0);
+
+    // send the pending batch frame when it reached the maximum delay
+    auto age = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - m_batch_start);
+    if (age.count() >= m_batch_max_delay) FlushBatch();
+
+    return(0);
+  }
+
+  size_t CDataWriter::SendFrame(const void* const buf_, size_t len_, long long time_, long long id_, long long clock_, bool batch_)
+  {
+    ECAL_TRACE_SCOPE(probe_writer_send, len_);
+
+    if (!batch_)
     {
-      if (!IsExtSubscribed())
-      {
-        // we have no external subscriptions,
-        // but we have local ones (otherwise we would have
-        // no subscriptions and this is checked with !IsSubscribed())
-        // so let's check if all local subscriptions are 
-        // "inner process only", that means
-        // they have all our process id
-        if (IsInternalSubscribedOnly())
-        {
-          // we can switch shared memory layer off
-          // it's all subscribed in our process
-          use_shm = TLayer::smode_off;
-        }
-      }
+      // increase overall sum send
+      g_process_sbytes_sum += len_;
+
+      // store size for monitoring
+      m_topic_size = len_;
     }
 
+    // layers to write, prepared by UpdateSendPlan
+    const unsigned int plan = m_send_plan;
+
+    // sample description shared by all layers
+    struct CDataWriterBase::SWriterData wdata;
+    wdata.buf   = buf_;
+    wdata.len   = len_;
+    wdata.id    = id_;
+    wdata.clock = clock_;
+    wdata.hash  = batch_ ? BatchFrameHash(m_topic_id_hash, clock_) : SendHash(clock_);
+    wdata.time  = time_;
+    wdata.batch = batch_;
+
+    // did we write anything
+    bool written(false);
+
     ////////////////////////////////////////////////////////////////////////////
     // LAYER 1 : INPROC
     ////////////////////////////////////////////////////////////////////////////
-    if  ((use_inproc == TLayer::smode_auto)
-      || (use_inproc == TLayer::smode_on)
-      )
+    if (plan & send_plan_inproc)
     {
 #ifndef NDEBUG
       // log it
@@ -479,21 +597,14 @@ namespace eCAL
       if (m_writer_inproc.PrepareSend(len_))
       {
         // register new to update listening subscribers
+        // (queued, the send call is not blocked)
         DoRegister(true);
-        // let's rematch writer / reader
-        Process::SleepMS(5);
       }
 
       // send it
       size_t inproc_sent(0);
       {
-        struct CDataWriterBase::SWriterData wdata;
-        wdata.buf   = buf_;
-        wdata.len   = len_;
-        wdata.id    = m_id;
-        wdata.clock = m_clock;
-        wdata.hash  = snd_hash;
-        wdata.time  = time_;
+        ECAL_TRACE_SCOPE(probe_writer_send_inproc, len_);
         inproc_sent = m_writer_inproc.Send(wdata);
         m_use_inproc_confirmed = true;
       }
@@ -518,10 +629,9 @@ namespace eCAL
     ////////////////////////////////////////////////////////////////////////////
     // LAYER 2 : SHM
     ////////////////////////////////////////////////////////////////////////////
-    if (((use_shm == TLayer::smode_auto) && m_loc_subscribed)
-      || (use_shm == TLayer::smode_on)
-      )
+    if (plan & send_plan_shm)
     {
+      std::lock_guard<std::mutex> lock(m_shm_send_sync);
 #ifndef NDEBUG
       // log it
       Logging::Log(log_level_debug3, m_topic_name + "::CDataWriter::Send::MemFile");
@@ -531,22 +641,15 @@ namespace eCAL
       if (m_writer_shm.PrepareSend(len_))
       {
         // register new to update listening subscribers
+        // (queued, the send call is not blocked)
         DoRegister(true);
-        // let's rematch writer / reader
-        Process::SleepMS(5);
       }
 
       // send it
       size_t shm_sent(0);
       {
-        struct CDataWriterBase::SWriterData wdata;
-        wdata.buf   = buf_;
-        wdata.len   = len_;
-        wdata.id    = m_id;
-        wdata.clock = m_clock;
-        wdata.hash  = snd_hash;
-        wdata.time  = time_;
-        shm_sent    = m_writer_shm.Send(wdata);
+        ECAL_TRACE_SCOPE(probe_writer_send_shm, len_);
+        shm_sent = m_writer_shm.Send(wdata);
         m_use_shm_confirmed = true;
       }
       written |= shm_sent > 0;
@@ -564,125 +667,118 @@ namespace eCAL
 #endif
     }
 
-    ////////////////////////////////////////////////////////////////////////////
-    // LAYER 3 : UDP (MC)
-    ////////////////////////////////////////////////////////////////////////////
-    if (((use_udp_mc == TLayer::smode_auto) && m_ext_subscribed)
-      || (use_udp_mc == TLayer::smode_on)
-      )
+    if (plan & (send_plan_udp_mc | send_plan_udp_uc))
     {
-#ifndef NDEBUG
-      // log it
-      Logging::Log(log_level_debug3, m_topic_name + "::CDataWriter::Send::UDP_MC");
-#endif
-
-      // prepare send
-      bool prepared(false);
-      prepared = m_writer_udp_mc.PrepareSend(len_);
-
-      if (prepared)
+      std::lock_guard<std::mutex> lock(m_udp_send_sync);
+
+      ////////////////////////////////////////////////////////////////////////////
+      // UDP payload compression (once for both udp layers)
+      ////////////////////////////////////////////////////////////////////////////
+      struct CDataWriterBase::SWriterData udp_wdata(wdata);
+      udp_wdata.bandwidth = m_bandwidth_max_udp;
+      // if shared memory layer for local communication is switched off
+      // we activate udp message loopback to communicate with local processes too
+      udp_wdata.loopback  = (plan & send_plan_udp_loopback) != 0;
+      udp_wdata.raw_len   = len_;
+      if (m_udp_compression_agreed && (len_ >= PUB_UDP_COMPRESSION_MINSIZE))
       {
-        // register new to update listening subscribers
-        DoRegister(true);
-        // let's rematch writer / reader
-        Process::SleepMS(5);
+        const TLayer::eCompression compression = m_udp_compression;
+        if (Compression::Compress(compression, buf_, len_, m_udp_compression_buf))
+        {
+          udp_wdata.buf         = m_udp_compression_buf.data();
+          udp_wdata.len         = m_udp_compression_buf.size();
+          udp_wdata.compression = compression;
+        }
       }
 
-      // send it
-      size_t udp_mc_sent(0);
+      ////////////////////////////////////////////////////////////////////////////
+      // LAYER 3 : UDP (MC)
+      ////////////////////////////////////////////////////////////////////////////
+      if (plan & send_plan_udp_mc)
       {
-        // if shared memory layer for local communication is switched off
-        // we activate udp message loopback to communicate with local processes too
-        bool loopback = use_shm == TLayer::smode_off;
-
-        struct CDataWriterBase::SWriterData wdata;
-        wdata.buf       = buf_;
-        wdata.len       = len_;
-        wdata.id        = m_id;
-        wdata.clock     = m_clock;
-        wdata.hash      = snd_hash;
-        wdata.time      = time_;
-        wdata.bandwidth = m_bandwidth_max_udp;
-        wdata.loopback  = loopback;
-        udp_mc_sent     = m_writer_udp_mc.Send(wdata);
-        m_use_udp_mc_confirmed = true;
-      }
-      written |= udp_mc_sent > 0;
-
 #ifndef NDEBUG
-      // log it
-      if (udp_mc_sent > 0)
-      {
-        Logging::Log(log_level_debug3, m_topic_name + "::CDataWriter::Send::UDP_MC - SUCCESS");
-      }
-      else
-      {
-        Logging::Log(log_level_error, m_topic_name + "::CDataWriter::Send::UDP_MC - FAILED");
-      }
+        // log it
+        Logging::Log(log_level_debug3, m_topic_name + "::CDataWriter::Send::UDP_MC");
 #endif
-    }
 
-    ////////////////////////////////////////////////////////////////////////////
-    // LAYER 4 : UDP (UC)
-    ////////////////////////////////////////////////////////////////////////////
-    if (use_udp_uc == TLayer::smode_on)
-    {
-#ifndef NDEBUG
-      // log it
-      Logging::Log(log_level_debug3, m_topic_name + "::CDataWriter::Send::UDP_UC");
-#endif
+        // prepare send
+        if (m_writer_udp_mc.PrepareSend(len_))
+        {
+          // register new to update listening subscribers
+          // (queued, the send call is not blocked)
+          DoRegister(true);
+        }
 
-      // prepare send
-      bool prepared(false);
-      prepared = m_writer_udp_uc.PrepareSend(len_);
+        // send it
+        size_t udp_mc_sent(0);
+        {
+          ECAL_TRACE_SCOPE(probe_writer_send_udp_mc, len_);
+          udp_mc_sent = m_writer_udp_mc.Send(udp_wdata);
+          m_use_udp_mc_confirmed = true;
+        }
+        written |= udp_mc_sent > 0;
 
-      if (prepared)
-      {
-        // register new to update listening subscribers
-        DoRegister(true);
-        // let's rematch writer / reader
-        Process::SleepMS(5);
+#ifndef NDEBUG
+        // log it
+        if (udp_mc_sent > 0)
+        {
+          Logging::Log(log_level_debug3, m_topic_name + "::CDataWriter::Send::UDP_MC - SUCCESS");
+        }
+        else
+        {
+          Logging::Log(log_level_error, m_topic_name + "::CDataWriter::Send::UDP_MC - FAILED");
+        }
+#endif
       }
 
-      // send it
-      size_t udp_uc_sent(0);
+      ////////////////////////////////////////////////////////////////////////////
+      // LAYER 4 : UDP (UC)
+      ////////////////////////////////////////////////////////////////////////////
+      if (plan & send_plan_udp_uc)
       {
-        // if shared memory layer for local communication is switched off
-        // we activate udp message loopback to communicate with local processes too
-        bool loopback = use_shm == TLayer::smode_off;
-
-        struct CDataWriterBase::SWriterData wdata;
-        wdata.buf       = buf_;
-        wdata.len       = len_;
-        wdata.id        = m_id;
-        wdata.clock     = m_clock;
-        wdata.hash      = snd_hash;
-        wdata.time      = time_;
-        wdata.bandwidth = m_bandwidth_max_udp;
-        wdata.loopback  = loopback;
-        udp_uc_sent     = m_writer_udp_uc.Send(wdata);
-        m_use_udp_uc_confirmed = true;
-      }
-      written |= udp_uc_sent > 0;
+#ifndef NDEBUG
+        // log it
+        Logging::Log(log_level_debug3, m_topic_name + "::CDataWriter::Send::UDP_UC");
+#endif
+
+        // prepare send
+        if (m_writer_udp_uc.PrepareSend(len_))
+        {
+          // register new to update listening subscribers
+          // (queued, the send call is not blocked)
+          DoRegister(true);
+        }
+
+        // send it
+        size_t udp_uc_sent(0);
+        {
+          ECAL_TRACE_SCOPE(probe_writer_send_udp_uc, len_);
+          udp_uc_sent = m_writer_udp_uc.Send(udp_wdata);
+          m_use_udp_uc_confirmed = true;
+        }
+        written |= udp_uc_sent > 0;
 
 #ifndef NDEBUG
-      // log it
-      if (udp_uc_sent > 0)
-      {
-        Logging::Log(log_level_debug3, m_topic_name + "::CDataWriter::Send::UDP_UC - SUCCESS");
-      }
-      else
-      {
-        Logging::Log(log_level_error, m_topic_name + "::CDataWriter::Send::UDP_UC - FAILED");
-      }
+        // log it
+        if (udp_uc_sent > 0)
+        {
+          Logging::Log(log_level_debug3, m_topic_name + "::CDataWriter::Send::UDP_UC - SUCCESS");
+        }
+        else
+        {
+          Logging::Log(log_level_error, m_topic_name + "::CDataWriter::Send::UDP_UC - FAILED");
+        }
 #endif
+      }
     }
 
+#ifdef ECAL_LAYER_LCM
     ////////////////////////////////////////////////////////////////////////////
     // LAYER 5 : LCM
     ////////////////////////////////////////////////////////////////////////////
-    if (use_lcm == TLayer::smode_on)
+    if (plan & send_plan_lcm)
     {
+      std::lock_guard<std::mutex> lock(m_lcm_send_sync);
 #ifndef NDEBUG
       // log it
       Logging::Log(log_level_debug3, m_topic_name + "::CDataWriter::Send::LCM");
@@ -692,22 +788,35 @@ namespace eCAL
       if (m_writer_lcm.PrepareSend(len_))
       {
         // register new to update listening subscribers
+        // (queued, the send call is not blocked)
         DoRegister(true);
-        // let's rematch writer / reader
-        Process::SleepMS(5);
       }
 
       // send it
       size_t lcm_sent(0);
       {
-        struct CDataWriterBase::SWriterData wdata;
-        wdata.buf   = buf_;
-        wdata.len   = len_;
-        wdata.id    = m_id;
-        wdata.clock = m_clock;
-        wdata.hash  = snd_hash;
-        wdata.time  = time_;
-        lcm_sent    = m_writer_lcm.Send(wdata) > 0;
+        ECAL_TRACE_SCOPE(probe_writer_send_lcm, len_);
+        if (batch_)
+        {
+          // lcm can not carry the batch flag, send the samples one by one
+          struct CDataWriterBase::SWriterData lcm_wdata(wdata);
+          lcm_wdata.batch = false;
+          auto send = [&](const char* sbuf_, size_t slen_, long long sid_, long long sclock_, long long stime_)
+          {
+            lcm_wdata.buf   = sbuf_;
+            lcm_wdata.len   = slen_;
+            lcm_wdata.id    = sid_;
+            lcm_wdata.clock = sclock_;
+            lcm_wdata.hash  = SendHash(sclock_);
+            lcm_wdata.time  = stime_;
+            lcm_sent       |= m_writer_lcm.Send(lcm_wdata) > 0;
+          };
+          ForEachBatchSample(static_cast<const char*>(buf_), len_, send);
+        }
+        else
+        {
+          lcm_sent = m_writer_lcm.Send(wdata) > 0;
+        }
         m_use_lcm_confirmed = true;
       }
       written |= lcm_sent > 0;
@@ -724,13 +833,15 @@ namespace eCAL
       }
 #endif
     }
+#endif /* ECAL_LAYER_LCM */
 
 #ifdef ECAL_LAYER_FASTRTPS 
     ////////////////////////////////////////////////////////////////////////////
     // LAYER 6 : FASTRTPS 
     ////////////////////////////////////////////////////////////////////////////
-    if (use_rtps == TLayer::smode_on)
+    if (plan & send_plan_rtps)
     {
+      std::lock_guard<std::mutex> lock(m_rtps_send_sync);
 #ifndef NDEBUG
       // log it
       Logging::Log(log_level_debug3, m_topic_name + "::CDataWriter::Send::RTPS");
@@ -740,22 +851,35 @@ namespace eCAL
       if (m_writer_rtps.PrepareSend(len_))
       {
         // register new to update listening subscribers
+        // (queued, the send call is not blocked)
         DoRegister(true);
-        // let's rematch writer / reader
-        Process::SleepMS(5);
       }
 
       // send it
       size_t rtps_sent(0);
       {
-        struct CDataWriterBase::SWriterData wdata;
-        wdata.buf   = buf_;
-        wdata.len   = len_;
-        wdata.id    = m_id;
-        wdata.clock = m_clock;
-        wdata.hash  = snd_hash;
-        wdata.time  = time_;
-        rtps_sent   = m_writer_rtps.Send(wdata) > 0;
+        ECAL_TRACE_SCOPE(probe_writer_send_rtps, len_);
+        if (batch_)
+        {
+          // rtps can not carry the batch flag, send the samples one by one
+          struct CDataWriterBase::SWriterData rtps_wdata(wdata);
+          rtps_wdata.batch = false;
+          auto send = [&](const char* sbuf_, size_t slen_, long long sid_, long long sclock_, long long stime_)
+          {
+            rtps_wdata.buf   = sbuf_;
+            rtps_wdata.len   = slen_;
+            rtps_wdata.id    = sid_;
+            rtps_wdata.clock = sclock_;
+            rtps_wdata.hash  = SendHash(sclock_);
+            rtps_wdata.time  = stime_;
+            rtps_sent       |= m_writer_rtps.Send(rtps_wdata) > 0;
+          };
+          ForEachBatchSample(static_cast<const char*>(buf_), len_, send);
+        }
+        else
+        {
+          rtps_sent = m_writer_rtps.Send(wdata) > 0;
+        }
         m_use_rtps_confirmed = true;
       }
       written |= rtps_sent > 0;
@@ -779,20 +903,110 @@ namespace eCAL
     else          return(len_);
   }
 
-  void CDataWriter::ApplyLocSubscription(const std::string& process_id_, const std::string& reader_par_)
+  void CDataWriter::UpdateSendPlan()
+  {
+    std::lock_guard<std::mutex> lock(m_send_plan_sync);
+
+    // check send modes
+    TLayer::eSendMode use_udp_mc(m_use_udp_mc);
+    TLayer::eSendMode use_udp_uc(m_use_udp_uc);
+    TLayer::eSendMode use_shm(m_use_shm);
+#ifdef ECAL_LAYER_LCM
+    TLayer::eSendMode use_lcm(m_use_lcm);
+#endif /* ECAL_LAYER_LCM */
+#ifdef ECAL_LAYER_FASTRTPS
+    TLayer::eSendMode use_rtps(m_use_rtps);
+#endif /* ECAL_LAYER_FASTRTPS */
+    TLayer::eSendMode use_inproc(m_use_inproc);
+    if ( (use_udp_mc == TLayer::smode_off)
+      && (use_udp_uc == TLayer::smode_off)
+      && (use_shm    == TLayer::smode_off)
+#ifdef ECAL_LAYER_LCM
+      && (use_lcm    == TLayer::smode_off)
+#endif /* ECAL_LAYER_LCM */
+#ifdef ECAL_LAYER_FASTRTPS
+      && (use_rtps   == TLayer::smode_off)
+#endif /* ECAL_LAYER_FASTRTPS */
+      && (use_inproc == TLayer::smode_off)
+      )
+    {
+      // failsafe default mode if
+      // nothing is activated
+      use_udp_mc = TLayer::smode_auto;
+      use_shm    = TLayer::smode_auto;
+    }
+
+    // if we do not have loopback
+    // enabled we can switch off
+    // inner process communication
+    if (g_reggate() && !g_reggate()->LoopBackEnabled())
+    {
+      use_inproc = TLayer::smode_off;
+    }
+    
+    // shared memory transport is on and
+    // inner process transport is on
+    // let's check if there is a need for
+    // shared memory because of external
+    // process subscription, if not
+    // let's switch it off
+    if  ((use_shm    != TLayer::smode_off)
+      && (use_inproc != TLayer::smode_off)
+      )
+    {
+      if (!IsExtSubscribed())
+      {
+        // we have no external subscriptions,
+        // but we have local ones (otherwise we would have
+        // no subscriptions and this is checked with !IsSubscribed())
+        // so let's check if all local subscriptions are 
+        // "inner process only", that means
+        // they have all our process id
+        if (IsInternalSubscribedOnly())
+        {
+          // we can switch shared memory layer off
+          // it's all subscribed in our process
+          use_shm = TLayer::smode_off;
+        }
+      }
+    }
+
+    unsigned int plan(0);
+    if ((use_inproc == TLayer::smode_auto) || (use_inproc == TLayer::smode_on))              plan |= send_plan_inproc;
+    if (((use_shm == TLayer::smode_auto) && m_loc_subscribed) || (use_shm == TLayer::smode_on)) plan |= send_plan_shm;
+    if (((use_udp_mc == TLayer::smode_auto) && m_ext_subscribed) || (use_udp_mc == TLayer::smode_on)) plan |= send_plan_udp_mc;
+    if (use_udp_uc == TLayer::smode_on)                                                          plan |= send_plan_udp_uc;
+    if (use_shm == TLayer::smode_off)                                                            plan |= send_plan_udp_loopback;
+#ifdef ECAL_LAYER_LCM
+    if (use_lcm == TLayer::smode_on)                                                             plan |= send_plan_lcm;
+#endif /* ECAL_LAYER_LCM */
+#ifdef ECAL_LAYER_FASTRTPS
+    if (use_rtps == TLayer::smode_on)                                                            plan |= send_plan_rtps;
+#endif /* ECAL_LAYER_FASTRTPS */
+
+    // store the new plan, a concurrent send uses either the old or the new one
+    m_send_plan = plan;
+  }
+
+  void CDataWriter::ApplyLocSubscription(const std::string& process_id_, const std::string& reader_par_, const std::string& udp_par_, const std::string& shm_par_)
   {
     SetConnected(true);
     {
       std::lock_guard<std::mutex> lock(m_sub_map_sync);
       m_loc_sub_map[process_id_] = true;
+      m_udp_par_map[m_host_name + ":" + process_id_] = udp_par_;
     }
     m_loc_subscribed = true;
+    UpdateCompressionAgreement();
+    UpdateSendPlan();
 
     // add a new local subscription
-    m_writer_udp_mc.AddLocConnection (process_id_, reader_par_);
-    m_writer_udp_uc.AddLocConnection (process_id_, reader_par_);
-    m_writer_shm.AddLocConnection    (process_id_, reader_par_);
+    m_writer_udp_mc.AddLocConnection (process_id_, udp_par_);
+    m_writer_udp_uc.AddLocConnection (process_id_, udp_par_);
+    m_writer_shm.AddLocConnection    (process_id_, shm_par_);
+#ifdef ECAL_LAYER_LCM
     m_writer_lcm.AddLocConnection    (process_id_, reader_par_);
+#endif /* ECAL_LAYER_LCM */
 #ifdef ECAL_LAYER_FASTRTPS
     m_writer_rtps.AddLocConnection   (process_id_, reader_par_);
 #endif /* ECAL_LAYER_FASTRTPS */
@@ -809,7 +1023,9 @@ namespace eCAL
     m_writer_udp_mc.RemLocConnection (process_id_);
     m_writer_udp_uc.RemLocConnection (process_id_);
     m_writer_shm.RemLocConnection    (process_id_);
+#ifdef ECAL_LAYER_LCM
     m_writer_lcm.RemLocConnection    (process_id_);
+#endif /* ECAL_LAYER_LCM */
 #ifdef ECAL_LAYER_FASTRTPS
     m_writer_rtps.RemLocConnection   (process_id_);
 #endif /* ECAL_LAYER_FASTRTPS */
@@ -820,20 +1036,25 @@ namespace eCAL
 #endif
   }
 
-  void CDataWriter::ApplyExtSubscription(const std::string& host_name_, const std::string& process_id_, const std::string& reader_par_)
+  void CDataWriter::ApplyExtSubscription(const std::string& host_name_, const std::string& process_id_, const std::string& reader_par_, const std::string& udp_par_)
   {
     SetConnected(true);
     {
       std::lock_guard<std::mutex> lock(m_sub_map_sync);
       m_ext_sub_map[host_name_] = true;
+      m_udp_par_map[host_name_ + ":" + process_id_] = udp_par_;
     }
     m_ext_subscribed = true;
+    UpdateCompressionAgreement();
+    UpdateSendPlan();
 
     // add a new external subscription
-    m_writer_udp_mc.AddExtConnection (host_name_, process_id_, reader_par_);
-    m_writer_udp_uc.AddExtConnection (host_name_, process_id_, reader_par_);
+    m_writer_udp_mc.AddExtConnection (host_name_, process_id_, udp_par_);
+    m_writer_udp_uc.AddExtConnection (host_name_, process_id_, udp_par_);
     m_writer_shm.AddExtConnection    (host_name_, process_id_, reader_par_);
+#ifdef ECAL_LAYER_LCM
     m_writer_lcm.AddExtConnection    (host_name_, process_id_, reader_par_);
+#endif /* ECAL_LAYER_LCM */
 #ifdef ECAL_LAYER_FASTRTPS
     m_writer_rtps.AddExtConnection   (host_name_, process_id_, reader_par_);
 #endif /* ECAL_LAYER_FASTRTPS */
@@ -850,7 +1071,9 @@ namespace eCAL
     m_writer_udp_mc.RemExtConnection (host_name_, process_id_);
     m_writer_udp_uc.RemExtConnection (host_name_, process_id_);
     m_writer_shm.RemExtConnection    (host_name_, process_id_);
+#ifdef ECAL_LAYER_LCM
     m_writer_lcm.RemExtConnection    (host_name_, process_id_);
+#endif /* ECAL_LAYER_LCM */
 #ifdef ECAL_LAYER_FASTRTPS
     m_writer_rtps.RemExtConnection   (host_name_, process_id_);
 #endif /* ECAL_LAYER_FASTRTPS */
@@ -907,10 +1130,13 @@ namespace eCAL
       std::lock_guard<std::mutex> lock(m_sub_map_sync);
       m_loc_sub_map.remove_deprecated(loc_timeouts.get());
       m_ext_sub_map.remove_deprecated();
+      m_udp_par_map.remove_deprecated();
 
       m_loc_subscribed = !m_loc_sub_map.empty();
       m_ext_subscribed = !m_ext_sub_map.empty();
     }
+    UpdateCompressionAgreement();
+    UpdateSendPlan();
 
     for(auto loc_sub : *loc_timeouts)
     {
@@ -923,13 +1149,15 @@ namespace eCAL
     }
   }
 
-  void CDataWriter::RefreshSendCounter()
+  long long CDataWriter::RefreshSendCounter()
   {
     // increase write clock
-    m_clock++;
+    const long long clock = ++m_clock;
 
     // statistics
     g_process_sclock++;
+
+    return(clock);
   }
 
   std::string CDataWriter::Dump(const std::string& indent_ /* = "" */)
@@ -986,7 +1214,7 @@ namespace eCAL
       tlayer->set_type(eCAL::pb::tl_ecal_udp_mc);
       tlayer->set_version(1);
       tlayer->set_confirmed(m_use_udp_mc_confirmed);
-      tlayer->set_par("");
+      tlayer->set_par(Compression::GetName(m_udp_compression));
     }
     // udp unicast layer
     {
@@ -994,7 +1222,7 @@ namespace eCAL
       tlayer->set_type(eCAL::pb::tl_ecal_udp_uc);
       tlayer->set_version(1);
       tlayer->set_confirmed(m_use_udp_uc_confirmed);
-      tlayer->set_par("");
+      tlayer->set_par(Compression::GetName(m_udp_compression));
     }
     // shm layer
     {
@@ -1004,6 +1232,7 @@ namespace eCAL
       tlayer->set_confirmed(m_use_shm_confirmed);
       tlayer->set_par(m_writer_shm.GetConectionPar());
     }
+#ifdef ECAL_LAYER_LCM
     // lcm layer
     {
       auto tlayer = ecal_reg_sample_mutable_topic->add_tlayer();
@@ -1012,6 +1241,7 @@ namespace eCAL
       tlayer->set_confirmed(m_use_lcm_confirmed);
       tlayer->set_par("");
     }
+#endif /* ECAL_LAYER_LCM */
 #ifdef ECAL_LAYER_FASTRTPS
     // rtps layer
     {
@@ -1195,6 +1425,7 @@ namespace eCAL
     return(true);
   }
 
+#ifdef ECAL_LAYER_LCM
   bool CDataWriter::SetUseLcm(TLayer::eSendMode mode_)
   {
     m_use_lcm = mode_;
@@ -1218,6 +1449,7 @@ namespace eCAL
 
     return(true);
   }
+#endif /* ECAL_LAYER_LCM */
 
 #ifdef ECAL_LAYER_FASTRTPS
   bool CDataWriter::SetUseRtps(TLayer::eSendMode mode_)
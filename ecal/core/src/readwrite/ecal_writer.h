@@ -28,11 +28,16 @@
 
 #include "ecal_def.h"
 #include "ecal_expmap.h"
+#include "ecal_thread.h"
+
+#include "ecal_batch.h"
 
 #include "ecal_writer_udp_mc.h"
 #include "ecal_writer_udp_uc.h"
 #include "ecal_writer_shm.h"
+#ifdef ECAL_LAYER_LCM
 #include "ecal_writer_lcm.h"
+#endif /* ECAL_LAYER_LCM */
 #ifdef ECAL_LAYER_FASTRTPS
 #include "ecal_writer_rtps.h"
 #endif /* ECAL_LAYER_FASTRTPS */
@@ -41,7 +46,9 @@
 #include <mutex>
 #include <string>
 #include <atomic>
+#include <functional>
 #include <map>
+#include <vector>
 
 namespace eCAL
 {
@@ -66,20 +73,23 @@ namespace eCAL
     bool SetLayerMode(TLayer::eTransportLayer layer_, TLayer::eSendMode mode_);
     bool SetRefFrequency(double fmin_, double fmax_);
     bool SetMaxBandwidthUDP(long bandwidth_);
+    bool SetBatching(size_t max_messages_, size_t max_bytes_, int max_delay_ms_);
+    bool SetCompressionUDP(TLayer::eCompression compression_);
 
     bool AddEventCallback(eCAL_Publisher_Event type_, PubEventCallbackT callback_);
     bool RemEventCallback(eCAL_Publisher_Event type_);
 
     size_t Send(const void* const buf_, size_t len_, long long time_, long long id_);
+    size_t Flush();
 
-    void ApplyLocSubscription(const std::string& process_id_, const std::string& reader_par_);
+    void ApplyLocSubscription(const std::string& process_id_, const std::string& reader_par_, const std::string& udp_par_, const std::string& shm_par_);
     void RemoveLocSubscription(const std::string & process_id_);
 
-    void ApplyExtSubscription(const std::string& host_name_, const std::string& process_id_, const std::string& reader_par_);
+    void ApplyExtSubscription(const std::string& host_name_, const std::string& process_id_, const std::string& reader_par_, const std::string& udp_par_);
     void RemoveExtSubscription(const std::string & host_name_, const std::string & process_id_);
 
     void RefreshRegistration();
-    void RefreshSendCounter();
+    long long RefreshSendCounter();
 
     std::string Dump(const std::string& indent_ = "");
 
@@ -98,10 +108,35 @@ namespace eCAL
     bool DoRegister(bool force_);
     void SetConnected(bool state_);
 
+    size_t SendFrame(const void* const buf_, size_t len_, long long time_, long long id_, long long clock_, bool batch_);
+    size_t AddBatchSample(const void* const buf_, size_t len_, long long time_, long long id_);
+    size_t FlushBatch();
+    int    BatchFlushThread();
+
+    void   UpdateCompressionAgreement();
+
+    // layers written by a send call, rebuilt by UpdateSendPlan
+    // whenever a send mode or a subscription changes
+    enum eSendPlan
+    {
+      send_plan_inproc       = 1 << 0,
+      send_plan_shm          = 1 << 1,
+      send_plan_udp_mc       = 1 << 2,
+      send_plan_udp_uc       = 1 << 3,
+      send_plan_udp_loopback = 1 << 4,
+      send_plan_lcm          = 1 << 5,
+      send_plan_rtps         = 1 << 6
+    };
+    void   UpdateSendPlan();
+
+    size_t SendHash(long long clock_) const { return(SampleHash(m_topic_id_hash, clock_)); }
+
     bool SetUseUdpMC(TLayer::eSendMode mode_);
     bool SetUseUdpUC(TLayer::eSendMode mode_);
     bool SetUseShm(TLayer::eSendMode mode_);
+#ifdef ECAL_LAYER_LCM
     bool SetUseLcm(TLayer::eSendMode mode_);
+#endif /* ECAL_LAYER_LCM */
 #ifdef ECAL_LAYER_FASTRTPS
     bool SetUseRtps(TLayer::eSendMode mode_);
 #endif /* ECAL_LAYER_FASTRTPS */
@@ -116,9 +151,10 @@ namespace eCAL
     std::string        m_pname;
     std::string        m_topic_name;
     std::string        m_topic_id;
+    size_t             m_topic_id_hash;
     std::string        m_topic_type;
     std::string        m_topic_desc;
-    size_t             m_topic_size;
+    std::atomic<size_t> m_topic_size;
 
     QOS::SWriterQOS    m_qos;
 
@@ -127,13 +163,15 @@ namespace eCAL
     std::mutex         m_sub_map_sync;
     ConnectedMapT      m_loc_sub_map;
     ConnectedMapT      m_ext_sub_map;
+    typedef Util::CExpMap<std::string, std::string> LayerParMapT;
+    LayerParMapT       m_udp_par_map;
 
     std::mutex         m_event_callback_sync;
     typedef std::map<eCAL_Publisher_Event, PubEventCallbackT> EventCallbackMapT;
     EventCallbackMapT  m_event_callback_map;
 
-    long long          m_id;
-    long long          m_clock;
+    std::atomic<long long> m_id;
+    std::atomic<long long> m_clock;
     long long          m_clock_old;
     std::chrono::steady_clock::time_point m_snd_time;
     long               m_freq;
@@ -144,34 +182,67 @@ namespace eCAL
 
     long               m_bandwidth_max_udp;
 
+    std::mutex         m_batch_sync;
+    std::atomic<bool>  m_batch_enabled;
+    size_t             m_batch_max_messages;
+    size_t             m_batch_max_bytes;
+    int                m_batch_max_delay;
+    std::vector<char>  m_batch_buf;
+    size_t             m_batch_count;
+    long long          m_batch_time;
+    std::chrono::steady_clock::time_point m_batch_start;
+    CThread            m_batch_thread;
+
+    std::atomic<TLayer::eCompression> m_udp_compression;
+    std::atomic<bool>                 m_udp_compression_agreed;
+    std::vector<char>                 m_udp_compression_buf;
+
+    // plan updates are serialized, so an update computed from older
+    // modes or subscriptions never overwrites a newer one
+    std::mutex                m_send_plan_sync;
+    std::atomic<unsigned int> m_send_plan;
+
+    // layer writers are not thread safe, concurrent send calls
+    // are serialized per layer (inproc needs no lock)
+    std::mutex         m_shm_send_sync;
+    std::mutex         m_udp_send_sync;
+#ifdef ECAL_LAYER_LCM
+    std::mutex         m_lcm_send_sync;
+#endif /* ECAL_LAYER_LCM */
+#ifdef ECAL_LAYER_FASTRTPS
+    std::mutex         m_rtps_send_sync;
+#endif /* ECAL_LAYER_FASTRTPS */
+
     std::atomic<bool>  m_loc_subscribed;
     std::atomic<bool>  m_ext_subscribed;
 
     TLayer::eSendMode  m_use_udp_mc;
     CDataWriterUdpMC   m_writer_udp_mc;
-    bool               m_use_udp_mc_confirmed;
+    std::atomic<bool>  m_use_udp_mc_confirmed;
 
     TLayer::eSendMode  m_use_udp_uc;
     CDataWriterUdpUC   m_writer_udp_uc;
-    bool               m_use_udp_uc_confirmed;
+    std::atomic<bool>  m_use_udp_uc_confirmed;
 
     TLayer::eSendMode  m_use_shm;
     CDataWriterSHM     m_writer_shm;
-    bool               m_use_shm_confirmed;
+    std::atomic<bool>  m_use_shm_confirmed;
 
+#ifdef ECAL_LAYER_LCM
     TLayer::eSendMode  m_use_lcm;
     CDataWriterLCM     m_writer_lcm;
-    bool               m_use_lcm_confirmed;
+    std::atomic<bool>  m_use_lcm_confirmed;
+#endif /* ECAL_LAYER_LCM */
 
 #ifdef ECAL_LAYER_FASTRTPS
     TLayer::eSendMode  m_use_rtps;
     CDataWriterRTPS    m_writer_rtps;
-    bool               m_use_rtps_confirmed;
+    std::atomic<bool>  m_use_rtps_confirmed;
 #endif /*ECAL_LAYER_FASTRTPS*/
 
     TLayer::eSendMode  m_use_inproc;
     CDataWriterInProc  m_writer_inproc;
-    bool               m_use_inproc_confirmed;
+    std::atomic<bool>  m_use_inproc_confirmed;
 
     bool               m_use_ttype;
     bool               m_use_tdesc;
@@ -87,6 +87,9 @@ namespace eCAL
         time             = 0;
         bandwidth        = -1;
         loopback         = 0;
+        batch            = false;
+        compression      = 0;
+        raw_len          = 0;
       }
       const void*  buf;
       size_t       len;
@@ -96,6 +99,9 @@ namespace eCAL
       long long    time;
       long         bandwidth;
       bool         loopback;
+      bool         batch;
+      int          compression;
+      size_t       raw_len;
     };
     virtual size_t Send(const SWriterData& data_) = 0;
 
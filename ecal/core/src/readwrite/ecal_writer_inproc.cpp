@@ -87,7 +87,7 @@ namespace eCAL
     // send it
     // no need to interpret return value 0 as error
     // maybe no one is subscribing in the current process
-    size_t sent = g_subgate()->ApplySample(m_topic_name, m_topic_id, static_cast<const char*>(data_.buf), data_.len, data_.id, data_.clock, data_.time, data_.hash, eCAL::pb::tl_inproc);
+    size_t sent = g_subgate()->ApplySample(m_topic_name, m_topic_id, static_cast<const char*>(data_.buf), data_.len, data_.id, data_.clock, data_.time, data_.hash, eCAL::pb::tl_inproc, data_.batch);
 
     return(sent);
   }
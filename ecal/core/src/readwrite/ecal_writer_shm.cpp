@@ -36,6 +36,7 @@
 #include <algorithm>
 #include <sstream>
 #include <chrono>
+#include <utility>
 
 namespace eCAL
 {
@@ -73,7 +74,11 @@ namespace eCAL
     m_timeout_qos_be = eCALPAR(PUB, MEMFILE_ACK_TO_QOS_BE);
     m_timeout_qos_re = eCALPAR(PUB, MEMFILE_ACK_TO_QOS_RE);
 
-    CreateMemFile(static_cast<size_t>(eCALPAR(PUB, MEMFILE_MINSIZE)));
+    m_memfile_attr.huge_pages = eCALPAR(PUB, MEMFILE_HUGE_PAGES) != 0;
+    m_memfile_attr.populate   = eCALPAR(PUB, MEMFILE_POPULATE)   != 0;
+    m_memfile_attr.numa_node  = eCALPAR(PUB, MEMFILE_NUMA_NODE);
+
+    CreateMemFile(static_cast<size_t>(eCALPAR(PUB, MEMFILE_MINSIZE)), BuildMemFileName());
 
     m_created = true;
     return true;
@@ -84,6 +89,7 @@ namespace eCAL
     if (!m_created) return false;
 
     DestroyMemFile();
+    m_memfile_broadcast_next.Close(true);
 
     m_created = false;
     return true;
@@ -110,12 +116,28 @@ namespace eCAL
 #endif
       // estimate size of memory file
       size_t memfile_reserve = static_cast<size_t>(eCALPAR(PUB, MEMFILE_RESERVE));
-      size_t memfile_size = sizeof(SEcalMessage) + len_ + static_cast<size_t>((static_cast<float>(memfile_reserve) / 100.0f) * static_cast<float>(len_));
+      size_t memfile_size = MemFileSizeClass(sizeof(SEcalMessage) + len_ + static_cast<size_t>((static_cast<float>(memfile_reserve) / 100.0f) * static_cast<float>(len_)));
+      // try to grow the existing memory file in place, the connected
+      // subscribers keep their name, events and threads and just remap
+      if (m_memfile.IsCreated() && m_memfile.Resize(memfile_size))
+      {
+#ifndef NDEBUG
+        // log it
+        Logging::Log(log_level_debug2, m_topic_name + "::CDataWriter::PrepareSend::ResizeFile (" + std::to_string(memfile_size) + " Bytes)");
+#endif
+        // nothing changed for the registration
+        return false;
+      }
+      // hand over the name of the next memory file generation
+      // to the connected subscribers, so they can follow without
+      // waiting for the next registration
+      const std::string memfile_name_next = BuildMemFileName();
+      if (m_memfile.IsCreated()) HandoffMemFile(memfile_name_next);
       // destroy existing memory file object
       DestroyMemFile();
       // and create a new one
-      CreateMemFile(memfile_size);
-      // return true to trigger registration and immediately inform listening subscribers
+      CreateMemFile(memfile_size, memfile_name_next);
+      // return true to trigger registration and inform subscribers that are not connected yet
       return true;
     }
 
@@ -158,6 +180,8 @@ namespace eCAL
     ecal_message.time      = static_cast<long long>(data_.time);
     // set header hash
     ecal_message.hash      = static_cast<size_t>(data_.hash);
+    // set batch frame flag
+    ecal_message.batch     = data_.batch ? 1 : 0;
 
     // open the memory file
     bool opened = m_memfile.Open(PUB_MEMFILE_OPEN_TO);
@@ -174,7 +198,7 @@ namespace eCAL
       // destroy and
       DestroyMemFile();
       // recreate it with the same size
-      if (!CreateMemFile(memfile_size)) return(0);
+      if (!CreateMemFile(memfile_size, BuildMemFileName())) return(0);
       // then reopen
       opened = m_memfile.Open(PUB_MEMFILE_OPEN_TO);
       // still no chance ? hell .... we give up
@@ -215,7 +239,7 @@ namespace eCAL
     return(data_.len);
   }
 
-  bool CDataWriterSHM::AddLocConnection(const std::string& process_id_, const std::string& /*conn_par_*/)
+  bool CDataWriterSHM::AddLocConnection(const std::string& process_id_, const std::string& conn_par_)
   {
     if (!m_created) return false;
 
@@ -227,15 +251,22 @@ namespace eCAL
 
     std::lock_guard<std::mutex> lock(m_event_handle_map_sync);
     EventHandleMapT::iterator iter = m_event_handle_map.find(process_id_);
+
     std::string event_ack_name = m_memfile_name + "_" + process_id_ + "_ack";
 
-    // add a new process id and create the sync and acknowledge event
+    // add a new process id and create the sync and acknowledge event,
+    // subscribers following the memory file broadcast do not need them,
+    // we only keep their process id to reconnect after a memory file recreation
     if (iter == m_event_handle_map.end())
     {
       SEventHandlePair event_pair;
-      std::string event_snd_name = m_memfile_name + "_" + process_id_;
-      gOpenEvent(&event_pair.event_snd, event_snd_name);
-      gOpenEvent(&event_pair.event_ack, event_ack_name);
+      event_pair.broadcast = (conn_par_ == PUB_MEMFILE_BC_READER_PAR);
+      if (UseEvents(event_pair))
+      {
+        std::string event_snd_name = m_memfile_name + "_" + process_id_;
+        gOpenEvent(&event_pair.event_snd, event_snd_name);
+        gOpenEvent(&event_pair.event_ack, event_ack_name);
+      }
       m_event_handle_map.insert(std::pair<std::string, SEventHandlePair>(process_id_, event_pair));
       return true;
     }
@@ -244,7 +275,7 @@ namespace eCAL
       // okay we have registered process events for that process id
       // we have to check the acknowledge event because it's possible that this
       // event was deactivated by a sync timeout in SignalMemFileWritten
-      if (!gEventIsValid(iter->second.event_ack))
+      if (UseEvents(iter->second) && !gEventIsValid(iter->second.event_ack))
       {
         gOpenEvent(&iter->second.event_ack, event_ack_name);
       }
@@ -260,6 +291,9 @@ namespace eCAL
     // we close the associated sync events and
     // remove them from the event handle map
 
+    // release its broadcast reader slot
+    m_memfile_broadcast.RemoveReader(atoi(process_id_.c_str()));
+
     std::lock_guard<std::mutex> lock(m_event_handle_map_sync);
     EventHandleMapT::const_iterator iter = m_event_handle_map.find(process_id_);
     if (iter != m_event_handle_map.end())
@@ -284,18 +318,48 @@ namespace eCAL
   // fire the publisher events
   // connected subscribers will read the content from the memory file
   /////////////////////////////////////////////////////////////////
-  void CDataWriterSHM::SignalMemFileWritten(bool reliable_)
+  bool CDataWriterSHM::UseEvents(const SEventHandlePair& event_pair_) const
   {
-    std::lock_guard<std::mutex> lock(m_event_handle_map_sync);
+    // older subscribers and all subscribers of a publisher
+    // without broadcast signal are synchronized by events
+    return(!event_pair_.broadcast || !m_memfile_broadcast.IsOpened());
+  }
 
+  void CDataWriterSHM::SignalMemFileWritten(bool reliable_)
+  {
     long           timeout = m_timeout_qos_be;
     if (reliable_) timeout = m_timeout_qos_re;
 
+    // one wake up for all local subscribers following the broadcast,
+    // they acknowledge by their sequence number in the reader slots
+    uint32_t seq(0);
+    if (m_memfile_broadcast.IsOpened()) seq = m_memfile_broadcast.Publish();
+
+    // the other subscribers are signaled by their process events
+    SignalMemFileEvents(timeout);
+
+    if (m_memfile_broadcast.IsOpened() && (timeout != 0))
+    {
+      if (!m_memfile_broadcast.WaitForAcknowledge(seq, timeout))
+      {
+#ifndef NDEBUG
+        // log it
+        Logging::Log(log_level_debug2, m_topic_name + "::CDataWriter::SignalMemFileWritten - ACK timeout");
+#endif
+      }
+    }
+  }
+
+  void CDataWriterSHM::SignalMemFileEvents(long timeout_)
+  {
+    std::lock_guard<std::mutex> lock(m_event_handle_map_sync);
+
     // "eat" old acknowledge events :)
-    if (timeout != 0)
+    if (timeout_ != 0)
     {
-      for (auto iter : m_event_handle_map)
+      for (const auto& iter : m_event_handle_map)
       {
+        if (!UseEvents(iter.second)) continue;
         while (gWaitForEvent(iter.second.event_ack, 0)) {}
       }
     }
@@ -303,13 +367,15 @@ namespace eCAL
     // send new sync
     for (auto iter = m_event_handle_map.begin(); iter != m_event_handle_map.end(); ++iter)
     {
+      if (!UseEvents(iter->second)) continue;
+
       // send sync event
       gSetEvent(iter->second.event_snd);
 
       // sync on acknowledge event
-      if (timeout != 0)
+      if (timeout_ != 0)
       {
-        if (!gWaitForEvent(iter->second.event_ack, timeout))
+        if (!gWaitForEvent(iter->second.event_ack, timeout_))
         {
           // we close the event immediately to not waste time in the next
           // write call, the event will be reopened later
@@ -331,35 +397,50 @@ namespace eCAL
     }
   }
 
-  void CDataWriterSHM::BuildMemFileName()
+  std::string CDataWriterSHM::BuildMemFileName()
   {
     std::stringstream out;
     out << m_topic_name << "_" << std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
-    m_memfile_name = out.str();
+    std::string memfile_name = out.str();
 
     // replace all '\\' to '_'
-    std::replace(m_memfile_name.begin(), m_memfile_name.end(), '\\', '_');
+    std::replace(memfile_name.begin(), memfile_name.end(), '\\', '_');
 
     // replace all '/' to '_'
-    std::replace(m_memfile_name.begin(), m_memfile_name.end(), '/', '_');
+    std::replace(memfile_name.begin(), memfile_name.end(), '/', '_');
 
     // append "_mem" for debugging puposes
-    m_memfile_name += "_shm";
+    memfile_name += "_shm";
+
+    return(memfile_name);
   }
 
-  bool CDataWriterSHM::CreateMemFile(size_t size_)
+  size_t CDataWriterSHM::MemFileSizeClass(size_t size_)
   {
-    // build new memory file name
-    BuildMemFileName();
+    // grow geometrically from the minimal size, so topics
+    // with varying payload size settle after a few resizes
+    size_t memfile_size = static_cast<size_t>(eCALPAR(PUB, MEMFILE_MINSIZE));
+    if (memfile_size == 0) memfile_size = PUB_MEMFILE_MINSIZE;
+    while (memfile_size < size_) memfile_size *= 2;
+    return(memfile_size);
+  }
+
+  bool CDataWriterSHM::CreateMemFile(size_t size_, const std::string& memfile_name_)
+  {
+    // set new memory file name
+    m_memfile_name = memfile_name_;
 
     // create new memory file object
     size_t minsize = static_cast<size_t>(eCALPAR(PUB, MEMFILE_MINSIZE));
     if (size_ < minsize) size_ = minsize;
-    if (!m_memfile.Create(m_memfile_name.c_str(), true, size_))
+    if (!m_memfile.Create(m_memfile_name.c_str(), true, size_, m_memfile_attr))
     {
       // log it
       Logging::Log(log_level_error, std::string(m_topic_name + "::CDataWriter::CreateMemFile - FAILED : ") + m_memfile_name);
 
+      // drop the broadcast signal prepared for this generation
+      m_memfile_broadcast_next.Close(true);
+
       return(false);
     }
 
@@ -374,26 +455,66 @@ namespace eCAL
     m_memfile.Write(&ecal_message, ecal_message.hdr_size, 0);
     m_memfile.Close();
 
+    // create the broadcast signal (not available on all platforms,
+    // the subscribers are signaled by per process events then),
+    // a handed over generation got it already before the handoff
+    m_memfile_broadcast.Swap(m_memfile_broadcast_next);
+    m_memfile_broadcast_next.Close(true);
+    if (!m_memfile_broadcast.IsOpened()) m_memfile_broadcast.Create(m_memfile_name);
+
     // collect all connected process id's
-    std::list<std::string> process_id_list;
+    std::list<std::pair<std::string, bool>> process_id_list;
     {
       std::lock_guard<std::mutex> lock(m_event_handle_map_sync);
       for (auto iter : m_event_handle_map)
       {
-        process_id_list.push_back(iter.first);
+        process_id_list.push_back(std::make_pair(iter.first, iter.second.broadcast));
       }
     }
 
     // and recreate immediately the new events
     for (auto process_id : process_id_list)
     {
-      RemLocConnection(process_id);
-      AddLocConnection(process_id, "");
+      RemLocConnection(process_id.first);
+      AddLocConnection(process_id.first, process_id.second ? PUB_MEMFILE_BC_READER_PAR : "");
     }
 
     return(true);
   }
 
+  bool CDataWriterSHM::HandoffMemFile(const std::string& memfile_name_next_)
+  {
+    // create the broadcast signal of the next generation before the
+    // subscribers learn its name, so they can open it right away
+    // (CreateMemFile takes it over)
+    m_memfile_broadcast_next.Create(memfile_name_next_);
+
+    if (!m_memfile.Open(PUB_MEMFILE_OPEN_TO)) return(false);
+
+    // the handoff message has no clock, so it is never
+    // delivered as sample by subscribers without handoff support
+    struct SEcalMessage ecal_message;
+    ecal_message.data_size = static_cast<unsigned long>(memfile_name_next_.size());
+    ecal_message.handoff   = 1;
+
+    bool written(true);
+    size_t wbytes(0);
+    written &= m_memfile.Write(&ecal_message, ecal_message.hdr_size, wbytes) > 0;
+    wbytes += ecal_message.hdr_size;
+    written &= m_memfile.Write(memfile_name_next_.data(), memfile_name_next_.size(), wbytes) > 0;
+    m_memfile.Close();
+
+    // inform connected subscribers
+    if (written) SignalMemFileWritten(m_qos.reliability == QOS::reliable_reliability_qos);
+
+#ifndef NDEBUG
+    // log it
+    Logging::Log(log_level_debug2, m_topic_name + "::CDataWriter::HandoffMemFile - " + m_memfile_name + " -> " + memfile_name_next_);
+#endif
+
+    return(written);
+  }
+
   bool CDataWriterSHM::DestroyMemFile()
   {
     // fire acknowledge events, to unlock blocking send function
@@ -415,6 +536,9 @@ namespace eCAL
       gInvalidateEvent(&iter->second.event_ack);
     }
 
+    // remove the broadcast signal
+    m_memfile_broadcast.Close(true);
+
     // destroy the file
     if (!m_memfile.Destroy(true))
     {
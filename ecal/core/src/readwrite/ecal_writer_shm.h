@@ -27,6 +27,7 @@
 
 #include "readwrite/ecal_writer_base.h"
 #include "io/ecal_memfile.h"
+#include "io/ecal_memfile_broadcast.h"
 
 #include <ecal/ecal_eventhandle.h>
 
@@ -60,20 +61,30 @@ namespace eCAL
 
   protected:
     void SignalMemFileWritten(bool reliable_);
+    void SignalMemFileEvents(long timeout_);
 
-    void BuildMemFileName();
-    bool CreateMemFile(size_t size_);
+    std::string BuildMemFileName();
+    size_t MemFileSizeClass(size_t size_);
+    bool CreateMemFile(size_t size_, const std::string& memfile_name_);
+    bool HandoffMemFile(const std::string& memfile_name_next_);
     bool DestroyMemFile();
 
     std::string      m_memfile_name;
     CMemoryFile      m_memfile;
+    CMemFileBroadcast m_memfile_broadcast;
+    CMemFileBroadcast m_memfile_broadcast_next;
+    SMemFileAttr     m_memfile_attr;
 
     struct SEventHandlePair
     {
+      SEventHandlePair() : broadcast(false) {};
       EventHandleT event_snd;
       EventHandleT event_ack;
+      bool         broadcast;    // subscriber follows the memory file broadcast
     };
     typedef std::unordered_map<std::string, SEventHandlePair> EventHandleMapT;
+    bool UseEvents(const SEventHandlePair& event_pair_) const;
+
     std::mutex       m_event_handle_map_sync;
     EventHandleMapT  m_event_handle_map;
 
@@ -117,6 +117,9 @@ namespace eCAL
     ecal_sample_mutable_content->set_clock(data_.clock);
     ecal_sample_mutable_content->set_time(data_.time);
     ecal_sample_mutable_content->set_hash(data_.hash);
+    ecal_sample_mutable_content->set_batch(data_.batch);
+    ecal_sample_mutable_content->set_compression(data_.compression);
+    ecal_sample_mutable_content->set_raw_size(static_cast<google::protobuf::int64>(data_.raw_len));
     ecal_sample_mutable_content->set_size((google::protobuf::int32)data_.len);
     ecal_sample_mutable_content->set_payload(data_.buf, data_.len);
 
@@ -21,6 +21,7 @@
  * @brief  eCAL tcp server based on asio c++
 **/
 
+#include "ecal_thread.h"
 #include "ecal_tcpserver.h"
 
 namespace eCAL
@@ -71,6 +72,8 @@ namespace eCAL
   
   void CTcpServer::ServerThread(std::uint32_t port_, RequestCallbackT callback_)
   {
+    SetCurrentThreadAttr(Thread::thread_class_service, "ecal_srv_tcp");
+
     m_io_service = std::make_shared<asio::io_service>();
     m_server = std::make_shared<CAsioServer>(*m_io_service, static_cast<unsigned short>(port_));
     m_server->add_request_callback(callback_);
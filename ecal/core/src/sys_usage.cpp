@@ -23,6 +23,8 @@
 
 #include <ecal/ecal_os.h>
 
+#include "sys_usage.h"
+
 #ifdef ECAL_OS_WINDOWS
 
 #include "ecal_win_main.h"
@@ -184,13 +186,171 @@ float GetCPULoad()
   return(usage * 0.01f);
 }
 
+bool GetProcessUsage(SProcessUsage& usage_)
+{
+  PROCESS_MEMORY_COUNTERS pmc;
+  if (!GetProcessMemoryInfo(GetCurrentProcess(), &pmc, sizeof(pmc))) return(false);
+  usage_.memory_virtual  = pmc.PagefileUsage;
+  usage_.memory_resident = pmc.WorkingSetSize;
+  return(true);
+}
+
 #endif /* ECAL_OS_WINDOWS */
 
 #ifdef ECAL_OS_LINUX
 
+#include <chrono>
+#include <mutex>
+
+#include <fcntl.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/resource.h>
+
+/**********************************************
+* CProcStat
+* keeps /proc/self/stat and /proc/self/statm open
+* for the process lifetime and rereads them with
+* pread into a stack buffer, so sampling needs
+* neither an open/close nor any heap allocation.
+* /proc/self is resolved when the files are opened,
+* so a forked child reopens them for its own pid.
+***********************************************/
+class CProcStat
+{
+public:
+  CProcStat() :
+    m_pid(getpid()),
+    m_stat_fd(open("/proc/self/stat", O_RDONLY | O_CLOEXEC)),
+    m_statm_fd(open("/proc/self/statm", O_RDONLY | O_CLOEXEC)),
+    m_page_size(static_cast<unsigned long long>(sysconf(_SC_PAGESIZE))),
+    m_cpu_count(sysconf(_SC_NPROCESSORS_ONLN)),
+    m_cpu_load(0.0f),
+    m_last_cpu_us(-1),
+    m_last_wall_us(0)
+  {
+    if (m_cpu_count < 1) m_cpu_count = 1;
+  }
+
+  ~CProcStat()
+  {
+    if (m_stat_fd  >= 0) close(m_stat_fd);
+    if (m_statm_fd >= 0) close(m_statm_fd);
+  }
+
+  bool GetUsage(SProcessUsage& usage_)
+  {
+    std::lock_guard<std::mutex> lock(m_sync);
+    CheckFork();
+
+    // statm: size resident shared text lib data dt (pages)
+    char buf[512];
+    if (!ReadFile(m_statm_fd, buf, sizeof(buf))) return(false);
+    char* pos = buf;
+    usage_.memory_virtual  = strtoull(pos, &pos, 10) * m_page_size;
+    usage_.memory_resident = strtoull(pos, &pos, 10) * m_page_size;
+
+    // stat: pid (comm) state ppid ... the command name may contain
+    // blanks and brackets, so count the fields from the last ')'
+    if (ReadFile(m_stat_fd, buf, sizeof(buf)))
+    {
+      pos = strrchr(buf, ')');
+      // num_threads is field 20, field 3 (state) follows the ')'
+      for (int field = 2; pos && (field < 20); ++field)
+      {
+        pos = strchr(pos + 1, ' ');
+      }
+      if (pos) usage_.threads = atoi(pos + 1);
+    }
+
+    struct rusage ru;
+    if (getrusage(RUSAGE_SELF, &ru) == 0)
+    {
+      usage_.ctx_switches_voluntary   = ru.ru_nvcsw;
+      usage_.ctx_switches_involuntary = ru.ru_nivcsw;
+    }
+    return(true);
+  }
+
+  float GetCPULoad()
+  {
+    std::lock_guard<std::mutex> lock(m_sync);
+    CheckFork();
+
+    struct rusage ru;
+    if (getrusage(RUSAGE_SELF, &ru) != 0) return(m_cpu_load);
+
+    const long long cpu_us  = (ru.ru_utime.tv_sec + ru.ru_stime.tv_sec) * 1000000LL + ru.ru_utime.tv_usec + ru.ru_stime.tv_usec;
+    const long long wall_us = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+
+    // if this is called too often, the measurement itself
+    // will greatly affect the results (see windows version)
+    const long long min_elapsed_us = 250 * 1000;
+    if (m_last_cpu_us < 0)
+    {
+      m_last_cpu_us  = cpu_us;
+      m_last_wall_us = wall_us;
+    }
+    else if (wall_us - m_last_wall_us > min_elapsed_us)
+    {
+      // share of the total cpu time of all cores, like GetSystemTimes on windows
+      m_cpu_load     = static_cast<float>(cpu_us - m_last_cpu_us) / static_cast<float>((wall_us - m_last_wall_us) * m_cpu_count);
+      m_last_cpu_us  = cpu_us;
+      m_last_wall_us = wall_us;
+    }
+    return(m_cpu_load);
+  }
+
+private:
+  void CheckFork()
+  {
+    const pid_t pid = getpid();
+    if (pid == m_pid) return;
+
+    // the inherited descriptors still refer to the parent process
+    if (m_stat_fd  >= 0) close(m_stat_fd);
+    if (m_statm_fd >= 0) close(m_statm_fd);
+    m_stat_fd      = open("/proc/self/stat", O_RDONLY | O_CLOEXEC);
+    m_statm_fd     = open("/proc/self/statm", O_RDONLY | O_CLOEXEC);
+    m_pid          = pid;
+
+    // the child starts with its own resource usage
+    m_cpu_load     = 0.0f;
+    m_last_cpu_us  = -1;
+    m_last_wall_us = 0;
+  }
+
+  static bool ReadFile(int fd_, char* buf_, size_t len_)
+  {
+    if (fd_ < 0) return(false);
+    const ssize_t read_len = pread(fd_, buf_, len_ - 1, 0);
+    if (read_len <= 0) return(false);
+    buf_[read_len] = '\0';
+    return(true);
+  }
+
+  std::mutex         m_sync;
+  pid_t              m_pid;
+  int                m_stat_fd;
+  int                m_statm_fd;
+  unsigned long long m_page_size;
+  long               m_cpu_count;
+  float              m_cpu_load;
+  long long          m_last_cpu_us;
+  long long          m_last_wall_us;
+};
+
+static CProcStat g_proc_stat;
+
+bool GetProcessUsage(SProcessUsage& usage_)
+{
+  return(g_proc_stat.GetUsage(usage_));
+}
+
 float GetCPULoad()
 {
-  return(0.0f);
+  return(g_proc_stat.GetCPULoad());
 }
 
 #endif /* ECAL_OS_LINUX */
@@ -23,4 +23,33 @@
 
 #pragma once
 
+/**
+ * @brief Process resource usage snapshot.
+**/
+struct SProcessUsage
+{
+  SProcessUsage() :
+    memory_virtual(0),
+    memory_resident(0),
+    threads(0),
+    ctx_switches_voluntary(0),
+    ctx_switches_involuntary(0)
+  {
+  }
+  unsigned long long memory_virtual;            //!< virtual memory size in bytes
+  unsigned long long memory_resident;           //!< resident set size in bytes
+  int                threads;                   //!< number of threads
+  long long          ctx_switches_voluntary;    //!< voluntary context switches since process start
+  long long          ctx_switches_involuntary;  //!< involuntary context switches since process start
+};
+
+/**
+ * @brief Sample the resource usage of the current process.
+ *
+ * @param usage_  Returned usage, values that are not available on the platform stay 0.
+ *
+ * @return  True if the usage could be sampled.
+**/
+bool GetProcessUsage(SProcessUsage& usage_);
+
 float GetCPULoad();
@@ -0,0 +1,450 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright (C) 2016 - 2019 Continental Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+/**
+ * pubsub_benchmark
+ *
+ * Sweeps payload size, transport layer, qos reliability, number of subscribers
+ * and publish rate in a single process (loopback) and writes one JSON record per run:
+ * throughput, latency percentiles, cpu time and heap allocations per message.
+ *
+ * example:
+ *   ecal_sample_pubsub_benchmark --layers shm,udp_mc --sizes 64,4096,1048576 --output result.json
+**/
+
+#include <ecal/ecal.h>
+
+#include <tclap/CmdLine.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <new>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#ifdef ECAL_OS_LINUX
+#include <sys/resource.h>
+#else
+#include <ctime>
+#endif
+
+////////////////////////////////////////////////////////
+// heap allocation counter (covers the eCAL library too)
+////////////////////////////////////////////////////////
+static std::atomic<unsigned long long> g_allocations(0);
+
+void* operator new(std::size_t size_)
+{
+  g_allocations.fetch_add(1, std::memory_order_relaxed);
+  if (void* ptr = std::malloc(size_ ? size_ : 1)) return(ptr);
+  throw std::bad_alloc();
+}
+
+void* operator new[](std::size_t size_)
+{
+  g_allocations.fetch_add(1, std::memory_order_relaxed);
+  if (void* ptr = std::malloc(size_ ? size_ : 1)) return(ptr);
+  throw std::bad_alloc();
+}
+
+void* operator new(std::size_t size_, const std::nothrow_t&) noexcept
+{
+  g_allocations.fetch_add(1, std::memory_order_relaxed);
+  return(std::malloc(size_ ? size_ : 1));
+}
+
+void* operator new[](std::size_t size_, const std::nothrow_t&) noexcept
+{
+  g_allocations.fetch_add(1, std::memory_order_relaxed);
+  return(std::malloc(size_ ? size_ : 1));
+}
+
+void operator delete(void* ptr_) noexcept                                  { std::free(ptr_); }
+void operator delete[](void* ptr_) noexcept                                { std::free(ptr_); }
+void operator delete(void* ptr_, std::size_t) noexcept                     { std::free(ptr_); }
+void operator delete[](void* ptr_, std::size_t) noexcept                   { std::free(ptr_); }
+void operator delete(void* ptr_, const std::nothrow_t&) noexcept           { std::free(ptr_); }
+void operator delete[](void* ptr_, const std::nothrow_t&) noexcept         { std::free(ptr_); }
+
+////////////////////////////////////////////////////////
+// helper
+////////////////////////////////////////////////////////
+static long long SteadyNanoSeconds()
+{
+  return(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count());
+}
+
+// process cpu time (user + system) in microseconds
+static long long CpuMicroSeconds()
+{
+#ifdef ECAL_OS_LINUX
+  struct rusage usage;
+  getrusage(RUSAGE_SELF, &usage);
+  return(static_cast<long long>(usage.ru_utime.tv_sec + usage.ru_stime.tv_sec) * 1000000LL + usage.ru_utime.tv_usec + usage.ru_stime.tv_usec);
+#else
+  return(static_cast<long long>(std::clock()) * 1000000LL / CLOCKS_PER_SEC);
+#endif
+}
+
+static std::vector<std::string> SplitList(const std::string& list_)
+{
+  std::vector<std::string> items;
+  std::stringstream stream(list_);
+  std::string item;
+  while (std::getline(stream, item, ','))
+  {
+    if (!item.empty()) items.push_back(item);
+  }
+  return(items);
+}
+
+// parse sizes like "64", "4k", "16M"
+static size_t ParseSize(const std::string& size_)
+{
+  size_t value = static_cast<size_t>(std::stoull(size_));
+  switch (size_.back())
+  {
+  case 'k': case 'K': return(value * 1024);
+  case 'm': case 'M': return(value * 1024 * 1024);
+  default:            return(value);
+  }
+}
+
+static bool ParseLayer(const std::string& name_, eCAL::TLayer::eTransportLayer& layer_)
+{
+  if      (name_ == "inproc") layer_ = eCAL::TLayer::tlayer_inproc;
+  else if (name_ == "shm")    layer_ = eCAL::TLayer::tlayer_shm;
+  else if (name_ == "udp_mc") layer_ = eCAL::TLayer::tlayer_udp_mc;
+  else if (name_ == "udp_uc") layer_ = eCAL::TLayer::tlayer_udp_uc;
+  else if (name_ == "lcm")    layer_ = eCAL::TLayer::tlayer_lcm;
+  else if (name_ == "rtps")   layer_ = eCAL::TLayer::tlayer_rtps;
+  else return(false);
+  return(true);
+}
+
+////////////////////////////////////////////////////////
+// benchmark
+////////////////////////////////////////////////////////
+struct SRunConfig
+{
+  std::string  layer_name;
+  eCAL::TLayer::eTransportLayer layer;
+  size_t       size;
+  bool         reliable;
+  int          subscribers;
+  int          rate;      // messages / s, 0 == as fast as possible
+  int          messages;
+};
+
+struct SRunResult
+{
+  long long    sent;
+  long long    received;
+  double       elapsed_s;         // first send until last receive, time base of all rates
+  double       throughput_mb_s;
+  double       throughput_msg_s;
+  double       latency_p50_us;
+  double       latency_p99_us;
+  double       latency_p999_us;
+  double       latency_max_us;
+  double       cpu_us_per_msg;    // measured over the send window
+  double       allocs_per_msg;    // measured over the send window
+};
+
+// latency recorder of one subscriber, callbacks of one subscriber are serialized
+class CLatencyRecorder
+{
+public:
+  explicit CLatencyRecorder(size_t capacity_) : m_count(0), m_last_receive(0), m_latency(capacity_) {}
+
+  void OnReceive(const char* /*topic_name_*/, const struct eCAL::SReceiveCallbackData* data_)
+  {
+    const long long now = SteadyNanoSeconds();
+    if (data_->size < static_cast<long>(sizeof(long long))) return;
+    long long snd_time(0);
+    memcpy(&snd_time, data_->buf, sizeof(snd_time));
+    const size_t idx = m_count.fetch_add(1, std::memory_order_relaxed);
+    if (idx < m_latency.size()) m_latency[idx] = now - snd_time;
+    m_last_receive.store(now, std::memory_order_relaxed);
+  }
+
+  void Reset() { m_count = 0; m_last_receive = 0; }
+  size_t Count() const { return(std::min<size_t>(m_count, m_latency.size())); }
+  long long LastReceive() const { return(m_last_receive); }
+  const std::vector<long long>& Latency() const { return(m_latency); }
+
+private:
+  std::atomic<size_t>    m_count;
+  std::atomic<long long> m_last_receive;
+  std::vector<long long> m_latency;
+};
+
+static double Percentile(std::vector<long long>& values_, double percentile_)
+{
+  if (values_.empty()) return(0.0);
+  size_t idx = static_cast<size_t>(percentile_ * (values_.size() - 1));
+  std::nth_element(values_.begin(), values_.begin() + idx, values_.end());
+  return(values_[idx] / 1000.0);
+}
+
+// returns false if the transport layer is not available in this eCAL build
+static bool RunBenchmark(const SRunConfig& cfg_, int reg_time_, SRunResult& result_)
+{
+  const std::string topic_name = "pubsub_benchmark";
+
+  // publisher with a single transport layer
+  eCAL::CPublisher pub;
+  eCAL::QOS::SWriterQOS wqos;
+  wqos.reliability = cfg_.reliable ? eCAL::QOS::reliable_reliability_qos : eCAL::QOS::best_effort_reliability_qos;
+  pub.SetQOS(wqos);
+  pub.SetLayerMode(eCAL::TLayer::tlayer_all, eCAL::TLayer::smode_off);
+  if (!pub.SetLayerMode(cfg_.layer, eCAL::TLayer::smode_on)) return(false);
+  pub.Create(topic_name);
+
+  // subscribers
+  std::vector<std::unique_ptr<CLatencyRecorder>>   recorder;
+  std::vector<std::unique_ptr<eCAL::CSubscriber>>  subs;
+  for (int i = 0; i < cfg_.subscribers; ++i)
+  {
+    recorder.emplace_back(new CLatencyRecorder(static_cast<size_t>(cfg_.messages)));
+    subs.emplace_back(new eCAL::CSubscriber());
+    eCAL::QOS::SReaderQOS rqos;
+    rqos.reliability = cfg_.reliable ? eCAL::QOS::reliable_reliability_qos : eCAL::QOS::best_effort_reliability_qos;
+    subs.back()->SetQOS(rqos);
+    subs.back()->Create(topic_name);
+    subs.back()->AddReceiveCallback(std::bind(&CLatencyRecorder::OnReceive, recorder.back().get(), std::placeholders::_1, std::placeholders::_2));
+  }
+
+  // let them match
+  eCAL::Process::SleepMS(reg_time_);
+
+  // payload, the first 8 bytes carry the send time stamp
+  std::vector<char> payload(std::max(cfg_.size, sizeof(long long)), 'x');
+
+  // warm up connections and buffers
+  for (int i = 0; i < 10; ++i)
+  {
+    const long long snd_time = SteadyNanoSeconds();
+    memcpy(payload.data(), &snd_time, sizeof(snd_time));
+    pub.Send(payload.data(), payload.size());
+  }
+  eCAL::Process::SleepMS(200);
+  for (auto& rec : recorder) rec->Reset();
+
+  // measure
+  // all time stamps (pacing, send and receive times) are taken from the steady clock
+  const std::chrono::nanoseconds period(cfg_.rate > 0 ? 1000000000LL / cfg_.rate : 0);
+  const unsigned long long allocs_start = g_allocations.load();
+  const long long          cpu_start    = CpuMicroSeconds();
+  const auto               start        = std::chrono::steady_clock::now();
+  auto                     next         = start;
+  long long sent(0);
+  for (int i = 0; i < cfg_.messages; ++i)
+  {
+    if (cfg_.rate > 0)
+    {
+      next += period;
+      std::this_thread::sleep_until(next);
+    }
+    const long long snd_time = SteadyNanoSeconds();
+    memcpy(payload.data(), &snd_time, sizeof(snd_time));
+    if (pub.Send(payload.data(), payload.size()) > 0) sent++;
+  }
+  const auto send_finish = std::chrono::steady_clock::now();
+
+  // cpu time and allocations of the send window only (not of the drain wait below)
+  const long long          cpu_used    = CpuMicroSeconds() - cpu_start;
+  const unsigned long long allocs_used = g_allocations.load() - allocs_start;
+
+  // wait until all subscribers received everything (or nothing arrives any more)
+  size_t received(0);
+  for (int wait = 0; wait < 50; ++wait)
+  {
+    size_t now_received(0);
+    for (auto& rec : recorder) now_received += rec->Count();
+    if (now_received == static_cast<size_t>(sent) * recorder.size()) { received = now_received; break; }
+    if ((wait > 0) && (now_received == received)) break;
+    received = now_received;
+    eCAL::Process::SleepMS(20);
+  }
+
+  // delivery window, from the first send until the last receive
+  long long finish_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(send_finish.time_since_epoch()).count();
+  for (auto& rec : recorder) finish_ns = std::max(finish_ns, rec->LastReceive());
+
+  for (auto& sub : subs) sub->Destroy();
+  pub.Destroy();
+
+  // summarize
+  const std::chrono::duration<double> elapsed = std::chrono::nanoseconds(finish_ns) - start.time_since_epoch();
+  std::vector<long long> latency;
+  latency.reserve(received);
+  for (auto& rec : recorder) latency.insert(latency.end(), rec->Latency().begin(), rec->Latency().begin() + rec->Count());
+
+  // throughput counts the samples delivered to all subscribers within the delivery window
+  const double msgs      = static_cast<double>(std::max<long long>(sent, 1));
+  result_.sent             = sent;
+  result_.received         = static_cast<long long>(received);
+  result_.elapsed_s        = elapsed.count();
+  result_.throughput_mb_s  = (elapsed.count() > 0.0) ? (received * payload.size()) / (1024.0 * 1024.0) / elapsed.count() : 0.0;
+  result_.throughput_msg_s = (elapsed.count() > 0.0) ? received / elapsed.count() : 0.0;
+  result_.latency_p50_us   = Percentile(latency, 0.5);
+  result_.latency_p99_us   = Percentile(latency, 0.99);
+  result_.latency_p999_us  = Percentile(latency, 0.999);
+  result_.latency_max_us   = Percentile(latency, 1.0);
+  result_.cpu_us_per_msg   = cpu_used / msgs;
+  result_.allocs_per_msg   = allocs_used / msgs;
+  return(true);
+}
+
+static void WriteJson(std::ostream& out_, const SRunConfig& cfg_, const SRunResult& res_, bool first_)
+{
+  out_ << (first_ ? "" : ",\n") << "    {"
+       << "\"layer\": \""          << cfg_.layer_name << "\", "
+       << "\"size\": "             << cfg_.size << ", "
+       << "\"qos\": \""            << (cfg_.reliable ? "reliable" : "best_effort") << "\", "
+       << "\"subscribers\": "      << cfg_.subscribers << ", "
+       << "\"rate\": "             << cfg_.rate << ", "
+       << "\"sent\": "             << res_.sent << ", "
+       << "\"received\": "         << res_.received << ", "
+       << "\"elapsed_s\": "        << res_.elapsed_s << ", "
+       << "\"throughput_mb_s\": "  << res_.throughput_mb_s << ", "
+       << "\"throughput_msg_s\": " << res_.throughput_msg_s << ", "
+       << "\"latency_p50_us\": "   << res_.latency_p50_us << ", "
+       << "\"latency_p99_us\": "   << res_.latency_p99_us << ", "
+       << "\"latency_p999_us\": "  << res_.latency_p999_us << ", "
+       << "\"latency_max_us\": "   << res_.latency_max_us << ", "
+       << "\"cpu_us_per_msg\": "   << res_.cpu_us_per_msg << ", "
+       << "\"allocs_per_msg\": "   << res_.allocs_per_msg
+       << "}";
+}
+
+int main(int argc, char **argv)
+{
+  try
+  {
+    // parse command line
+    TCLAP::CmdLine cmd("pubsub_benchmark");
+    TCLAP::ValueArg<std::string> layers     ("l", "layers",      "Comma separated transport layers (inproc, shm, udp_mc, udp_uc, lcm, rtps).", false, "inproc,shm,udp_mc", "list");
+    TCLAP::ValueArg<std::string> sizes      ("s", "sizes",       "Comma separated payload sizes in bytes (k / M suffix allowed).",              false, "64,1k,16k,256k,1M,16M,64M", "list");
+    TCLAP::ValueArg<std::string> qos        ("q", "qos",         "Comma separated qos reliability modes (best_effort, reliable).",              false, "best_effort,reliable", "list");
+    TCLAP::ValueArg<std::string> subscribers("n", "subscribers", "Comma separated number of subscribers.",                                      false, "1", "list");
+    TCLAP::ValueArg<std::string> rates      ("r", "rates",       "Comma separated publish rates in messages/s (0 == unlimited).",               false, "0", "list");
+    TCLAP::ValueArg<int>         messages   ("m", "messages",    "Maximum number of messages per run.",                                         false, 10000, "int");
+    TCLAP::ValueArg<int>         volume     ("v", "volume",      "Maximum data volume per run in MB (limits the messages of large payloads).",  false, 512, "int");
+    TCLAP::ValueArg<int>         regtime    ("t", "regtime",     "Time to match publisher and subscribers in ms.",                              false, 2000, "int");
+    TCLAP::ValueArg<std::string> output     ("o", "output",      "JSON result file (default stdout).",                                          false, "", "file");
+    cmd.add(layers);
+    cmd.add(sizes);
+    cmd.add(qos);
+    cmd.add(subscribers);
+    cmd.add(rates);
+    cmd.add(messages);
+    cmd.add(volume);
+    cmd.add(regtime);
+    cmd.add(output);
+    cmd.parse(argc, argv);
+
+    // build run list
+    std::vector<SRunConfig> runs;
+    for (const auto& layer_name : SplitList(layers.getValue()))
+    {
+      eCAL::TLayer::eTransportLayer layer(eCAL::TLayer::tlayer_none);
+      if (!ParseLayer(layer_name, layer))
+      {
+        std::cerr << "error: unknown layer " << layer_name << std::endl;
+        return EXIT_FAILURE;
+      }
+      for (const auto& size : SplitList(sizes.getValue()))
+      for (const auto& mode : SplitList(qos.getValue()))
+      for (const auto& nsub : SplitList(subscribers.getValue()))
+      for (const auto& rate : SplitList(rates.getValue()))
+      {
+        SRunConfig cfg;
+        cfg.layer_name  = layer_name;
+        cfg.layer       = layer;
+        cfg.size        = ParseSize(size);
+        cfg.reliable    = mode == "reliable";
+        cfg.subscribers = std::max(1, std::stoi(nsub));
+        cfg.rate        = std::max(0, std::stoi(rate));
+        const size_t volume_msgs = (static_cast<size_t>(volume.getValue()) * 1024 * 1024) / std::max<size_t>(cfg.size, 1);
+        cfg.messages    = static_cast<int>(std::max<size_t>(10, std::min<size_t>(static_cast<size_t>(messages.getValue()), volume_msgs)));
+        runs.push_back(cfg);
+      }
+    }
+
+    // initialize eCAL API
+    eCAL::Initialize(argc, argv, "pubsub_benchmark");
+
+    // publish / subscribe match in the same process
+    eCAL::Util::EnableLoopback(true);
+
+    std::ofstream file;
+    if (!output.getValue().empty()) file.open(output.getValue());
+    std::ostream& out = file.is_open() ? file : std::cout;
+
+    out << "{" << std::endl;
+    out << "  \"benchmark\": \"pubsub_benchmark\"," << std::endl;
+    out << "  \"ecal_version\": \"" << eCAL::GetVersionString() << "\"," << std::endl;
+    out << "  \"host\": \"" << eCAL::Process::GetHostName() << "\"," << std::endl;
+    out << "  \"runs\": [" << std::endl;
+    bool first(true);
+    for (size_t i = 0; (i < runs.size()) && eCAL::Ok(); ++i)
+    {
+      const SRunConfig& cfg = runs[i];
+      std::cerr << "run " << i + 1 << "/" << runs.size() << " : " << cfg.layer_name << ", " << cfg.size << " bytes, "
+                << (cfg.reliable ? "reliable" : "best_effort") << ", " << cfg.subscribers << " sub, " << cfg.rate << " msg/s" << std::endl;
+      SRunResult res = {};
+      if (!RunBenchmark(cfg, regtime.getValue(), res))
+      {
+        std::cerr << "skipped: layer " << cfg.layer_name << " is not available in this eCAL build" << std::endl;
+        continue;
+      }
+      WriteJson(out, cfg, res, first);
+      first = false;
+    }
+    if (!first) out << std::endl;
+    out << "  ]" << std::endl;
+    out << "}" << std::endl;
+
+    // finalize eCAL API
+    eCAL::Finalize();
+  }
+  catch (TCLAP::ArgException &e)  // catch any exceptions
+  {
+    std::cerr << "error: " << e.error() << " for arg " << e.argId() << std::endl;
+    return EXIT_FAILURE;
+  }
+  catch (std::exception& e)
+  {
+    std::cerr << "error: " << e.what() << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  return(0);
+}